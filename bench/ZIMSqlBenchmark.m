@@ -0,0 +1,114 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import "ZIMSqlExpression.h"
+#import "ZIMSqlSelectStatement.h"
+#import "ZIMSqlTokenizer.h"
+#import "ZIMSqlWriter.h"
+
+#if !defined(ZIMSqlBenchmarkSeconds)
+    #define ZIMSqlBenchmarkSeconds 1.0 // Override this pre-processing instruction on the command line (e.g. -DZIMSqlBenchmarkSeconds=5.0)
+#endif
+
+/*!
+ @function				ZIMSqlBenchmark
+ @discussion			This function will repeat the specified block for about ZIMSqlBenchmarkSeconds and
+						will print the throughput.
+ @param name			The name of the benchmark.
+ @param block			The block to be measured, which returns the number of bytes it processed.
+ @updated				2026-10-19
+ */
+static void ZIMSqlBenchmark(NSString *name, NSUInteger (^block)(void)) {
+	block(); // i.e. warms up any caches
+	NSUInteger bytes = 0;
+	NSUInteger iterations = 0;
+	NSDate *start = [NSDate date];
+	NSTimeInterval elapsed = 0.0;
+	do {
+		@autoreleasepool {
+			bytes += block();
+		}
+		iterations++;
+		elapsed = -[start timeIntervalSinceNow];
+	} while (elapsed < ZIMSqlBenchmarkSeconds);
+	printf("%-28s %10.2f MB/s %12lu iterations\n", [name UTF8String], (bytes / (1024.0 * 1024.0)) / elapsed, (unsigned long)iterations);
+}
+
+int main(int argc, const char *argv[]) {
+	@autoreleasepool {
+		NSMutableString *script = [[NSMutableString alloc] init];
+		for (NSUInteger i = 0; i < 1000; i++) {
+			[script appendFormat: @"SELECT [t].[id], \"name\", 0x%04lX, 'it''s %lu' FROM [table_%lu] AS t WHERE t.value >= %lu.5e3 -- note\n;", (unsigned long)i, (unsigned long)i, (unsigned long)(i % 7), (unsigned long)i];
+		}
+		NSUInteger scriptLength = [script lengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+
+		NSArray *identifiers = [NSArray arrayWithObjects: @"users", @"users.id", @"[order].[created_at]", @"\"Group\".name", @"t1.column_name", nil];
+		NSUInteger identifiersLength = 0;
+		for (NSString *identifier in identifiers) {
+			identifiersLength += [identifier lengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+		}
+
+		NSMutableData *blob = [[NSMutableData alloc] initWithLength: 64 * 1024];
+		arc4random_buf([blob mutableBytes], [blob length]);
+
+		NSMutableString *text = [[NSMutableString alloc] init];
+		for (NSUInteger i = 0; i < 4096; i++) {
+			[text appendString: (i % 16 == 0) ? @"'" : @"abc "];
+		}
+		NSUInteger textLength = [text lengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+
+		// Tokenizes an SQL script
+		ZIMSqlBenchmark(@"tokenizer", ^NSUInteger {
+			ZIMSqlTokenizer *tokenizer = [[ZIMSqlTokenizer alloc] initWithSqlStatement: script];
+			return ([tokenizer count] > 0) ? scriptLength : 0;
+		});
+
+		// Validates identifiers with the lookup tables
+		ZIMSqlBenchmark(@"prepareIdentifier", ^NSUInteger {
+			for (NSString *identifier in identifiers) {
+				[ZIMSqlExpression prepareIdentifier: identifier maxCount: 3]; // i.e. three segments are never cached
+			}
+			return identifiersLength;
+		});
+
+		// Encodes a blob literal
+		ZIMSqlBenchmark(@"blob literal", ^NSUInteger {
+			ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: [blob length] * 2 + 3];
+			[sql appendBlob: blob];
+			return [blob length];
+		});
+
+		// Escapes a string literal
+		ZIMSqlBenchmark(@"string literal", ^NSUInteger {
+			ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: textLength * 2 + 2];
+			[sql appendQuotedString: text];
+			return textLength;
+		});
+
+		// Renders a select statement into the shared writer
+		ZIMSqlBenchmark(@"select statement", ^NSUInteger {
+			ZIMSqlSelectStatement *select = [[ZIMSqlSelectStatement alloc] init];
+			[select column: @"id"];
+			[select column: @"name"];
+			[select from: @"users"];
+			[select where: @"name" operator: ZIMSqlOperatorEqualTo value: text];
+			[select where: @"age" operator: ZIMSqlOperatorGreaterThan value: [NSNumber numberWithInt: 21]];
+			return [[select statement] lengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+		});
+	}
+	return 0;
+}
@@ -0,0 +1,41 @@
+#!/bin/bash
+
+##
+# Copyright 2011 Ziminji
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at:
+# 
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+##
+
+##
+# INSTRUCTIONS
+#
+# This BASH script compiles the SQL builder classes together with ZIMSqlBenchmark.m and then
+# prints the throughput (in MB/s) of the tokenizer, identifier validation, literal encoding,
+# and statement rendering.  It requires clang and the Foundation framework (i.e. OS X).
+#
+# To run this BASH script, use the following commands:
+# 	username$ chmod +x ZIMSqlBenchmark.sh
+# 	username$ ./ZIMSqlBenchmark.sh [seconds]
+##
+
+declare -r BENCH_DIR="$(cd "$(dirname "$0")" && pwd)"
+declare -r SRC_DIR="${BENCH_DIR}/../src"
+declare -r BINARY="${TMPDIR:-/tmp}/ZIMSqlBenchmark"
+declare -r SECONDS_PER_BENCHMARK="${1:-1.0}"
+
+clang -O2 -fobjc-arc -DZIMSqlBenchmarkSeconds="${SECONDS_PER_BENCHMARK}" \
+	-I"${SRC_DIR}/ext" -I"${SRC_DIR}/sql" \
+	"${BENCH_DIR}/ZIMSqlBenchmark.m" "${SRC_DIR}"/ext/*.m "${SRC_DIR}"/sql/*.m \
+	-framework Foundation -lsqlite3 -o "${BINARY}" || exit 1
+
+"${BINARY}"
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import "ZIMDbBatchExecutorDelegate.h"
+
+@class ZIMDbConnection;
+
+/*!
+ @class					ZIMDbBatchExecutor
+ @discussion			This class runs a delete or update statement in key-bounded batches.  Each batch
+						is its own short transaction, and the executor pauses between batches, so that other
+						readers and writers are not stalled while a large number of rows are changed (e.g.
+						when a retention purge removes months of old rows).  Because the rows are visited in
+						key order, the work can be resumed after the last key that was committed.
+ @updated				2026-10-19
+ */
+@interface ZIMDbBatchExecutor : NSObject {
+
+	@protected
+		id __unsafe_unretained _delegate;
+		ZIMDbConnection *_connection;
+		id _statement;
+		NSString *_key;
+		NSUInteger _batchSize;
+		NSTimeInterval _pause;
+		id _lastKey;
+		NSUInteger _changes;
+		NSUInteger _batches;
+		BOOL _isFinished;
+		atomic_bool _isCancelled;
+
+}
+
+@property (nonatomic, unsafe_unretained) id delegate;
+
+/*!
+ @method				initWithConnection:statement:key:
+ @discussion			This constructor creates an instance of this class that will run the specified
+						statement in batches.
+ @param connection		The connection to be used.
+ @param statement		The statement to be run (i.e. either a ZIMSqlDeleteStatement or a
+						ZIMSqlUpdateStatement); its where clause selects the rows to be changed.
+ @param key				The unique column that orders the rows (e.g. "rowid" or the primary key).  An
+						update must not change this column, and rows whose key is NULL are skipped.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithConnection: (ZIMDbConnection *)connection statement: (id)statement key: (NSString *)key;
+/*!
+ @method				batchSize:
+ @discussion			This method sets the maximum number of rows that are changed by each batch.
+ @param size			The maximum number of rows in each batch.
+ @updated				2026-10-19
+ */
+- (void) batchSize: (NSUInteger)size;
+/*!
+ @method				pause:
+ @discussion			This method sets how long the executor will wait between batches.
+ @param pause			The number of seconds to wait.
+ @updated				2026-10-19
+ */
+- (void) pause: (NSTimeInterval)pause;
+/*!
+ @method				resumeAfter:
+ @discussion			This method will make the executor start after the specified key (e.g. the lastKey
+						that was saved when the executor was last stopped).
+ @param key				The last key that was committed.
+ @updated				2026-10-19
+ */
+- (void) resumeAfter: (id)key;
+/*!
+ @method				lastKey
+ @discussion			This method will return the key of the last row in the last committed batch.
+ @return				The last key that was committed (i.e. nil if no batch has been committed).
+ @updated				2026-10-19
+ */
+- (id) lastKey;
+/*!
+ @method				changes
+ @discussion			This method will return the number of rows that have been changed, including those
+						changed by triggers.
+ @return				The number of rows that have been changed.
+ @updated				2026-10-19
+ */
+- (NSUInteger) changes;
+/*!
+ @method				batches
+ @discussion			This method will return the number of batches that have been committed.
+ @return				The number of batches that have been committed.
+ @updated				2026-10-19
+ */
+- (NSUInteger) batches;
+/*!
+ @method				isFinished
+ @discussion			This method checks whether every matching row has been changed.
+ @return				Indicates whether the executor has finished.
+ @updated				2026-10-19
+ */
+- (BOOL) isFinished;
+/*!
+ @method				execute
+ @discussion			This method will run batches until every matching row has been changed, the
+						executor is cancelled, or the delegate asks it to stop.  It blocks, so it should
+						be called on a background queue.  If a batch fails, it is rolled back and the
+						exception is rethrown; the executor can then be resumed.
+ @return				Indicates whether the executor has finished.
+ @updated				2026-10-19
+ */
+- (BOOL) execute;
+/*!
+ @method				cancel
+ @discussion			This method will stop the executor once the current batch has been committed.
+						It may be called from any thread, even before the executor is run; call resumeAfter:
+						to run a cancelled executor again.
+ @updated				2026-10-19
+ */
+- (void) cancel;
+
+@end
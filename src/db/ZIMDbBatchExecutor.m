@@ -0,0 +1,138 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMDbBatchExecutor.h"
+#import "ZIMDbConnection.h"
+#import "ZIMSqlDeleteStatement.h"
+#import "ZIMSqlSelectStatement.h"
+#import "ZIMSqlUpdateStatement.h"
+
+@implementation ZIMDbBatchExecutor
+
+#if !defined(ZIMDbBatchExecutorBatchSize)
+    #define ZIMDbBatchExecutorBatchSize 500 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbBatchExecutorPause)
+    #define ZIMDbBatchExecutorPause 0.05 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+@synthesize delegate = _delegate;
+
+- (id) initWithConnection: (ZIMDbConnection *)connection statement: (id)statement key: (NSString *)key {
+	if ((self = [super init])) {
+		if (!([statement isKindOfClass: [ZIMSqlDeleteStatement class]] || [statement isKindOfClass: [ZIMSqlUpdateStatement class]])) {
+			@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"May only run a delete or update statement in batches." userInfo: nil];
+		}
+		_delegate = nil;
+		_connection = connection;
+		_statement = [statement copy];
+		_key = (key != nil) ? [key copy] : @"rowid";
+		_batchSize = ZIMDbBatchExecutorBatchSize;
+		_pause = ZIMDbBatchExecutorPause;
+		_lastKey = nil;
+		_changes = 0;
+		_batches = 0;
+		_isFinished = NO;
+		atomic_init(&_isCancelled, NO);
+	}
+	return self;
+}
+
+- (void) batchSize: (NSUInteger)size {
+	_batchSize = MAX(size, 1);
+}
+
+- (void) pause: (NSTimeInterval)pause {
+	_pause = MAX(pause, 0.0);
+}
+
+- (void) resumeAfter: (id)key {
+	_lastKey = key;
+	_isFinished = NO;
+	atomic_store(&_isCancelled, NO);
+}
+
+- (id) lastKey {
+	return _lastKey;
+}
+
+- (NSUInteger) changes {
+	return _changes;
+}
+
+- (NSUInteger) batches {
+	return _batches;
+}
+
+- (BOOL) isFinished {
+	return _isFinished;
+}
+
+- (BOOL) execute {
+	while (!_isFinished && !atomic_load(&_isCancelled)) {
+		NSUInteger count = 0;
+		[_connection beginTransaction];
+		@try {
+			// Note: The keys are selected within the same transaction, so the batch changes exactly these rows.
+			ZIMSqlSelectStatement *select = [_statement selectKey: _key after: _lastKey limit: _batchSize];
+			NSArray *records = [_connection query: [select parameterizedStatement] withParameters: [select parameters] temporaryTables: [select temporaryTables] asObject: [NSMutableDictionary class]];
+			count = [records count];
+			if (count > 0) {
+				id upper = [[records lastObject] objectForKey: @"key"];
+				id batch = [_statement copy];
+				[batch whereKey: _key after: _lastKey through: upper];
+				[_connection execute: [batch parameterizedStatement] withParameters: [batch parameters] temporaryTables: [batch temporaryTables]];
+				NSInteger changes = [_connection changes]; // i.e. before the commit is executed
+				[_connection commitTransaction];
+				_lastKey = upper;
+				_changes += (NSUInteger)MAX(changes, 0);
+				_batches++;
+			}
+			else {
+				[_connection commitTransaction];
+			}
+		}
+		@catch (NSException *exception) {
+			[_connection rollbackTransaction];
+			@throw exception;
+		}
+		_isFinished = (count < _batchSize);
+		if (count > 0) {
+			if ((_delegate != nil) && [_delegate respondsToSelector: @selector(executorDidFinishBatch:)]) {
+				[_delegate executorDidFinishBatch: self];
+			}
+		}
+		if (_isFinished) {
+			if ((_delegate != nil) && [_delegate respondsToSelector: @selector(executorDidFinishExecuting:)]) {
+				[_delegate executorDidFinishExecuting: self];
+			}
+			break;
+		}
+		if ((_delegate != nil) && [_delegate respondsToSelector: @selector(executorShouldContinue:)] && ![_delegate executorShouldContinue: self]) {
+			break;
+		}
+		if (_pause > 0.0) {
+			[NSThread sleepForTimeInterval: _pause]; // i.e. lets other connections take the write lock
+		}
+	}
+	return _isFinished;
+}
+
+- (void) cancel {
+	atomic_store(&_isCancelled, YES);
+}
+
+@end
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+@class ZIMDbBatchExecutor;
+
+/*!
+ @class					ZIMDbBatchExecutorDelegate
+ @discussion			This protocol specifies the methods that a delegate of ZIMDbBatchExecutor should
+						implement.
+ @updated				2026-10-19
+ */
+@protocol ZIMDbBatchExecutorDelegate <NSObject>
+
+@optional
+/*!
+ @method				executorDidFinishBatch:
+ @discussion			This method is called when an executor commits a batch.  The executor's lastKey
+						can be saved so that the work can be resumed later.
+ @param executor		The executor that is running the command.
+ @updated				2026-10-19
+ */
+- (void) executorDidFinishBatch: (ZIMDbBatchExecutor *)executor;
+/*!
+ @method				executorShouldContinue:
+ @discussion			This method is called before an executor starts the next batch.
+ @param executor		The executor that is running the command.
+ @return				Whether the executor should continue.
+ @updated				2026-10-19
+ */
+- (BOOL) executorShouldContinue: (ZIMDbBatchExecutor *)executor;
+/*!
+ @method				executorDidFinishExecuting:
+ @discussion			This method is called when an executor has changed every matching row.
+ @param executor		The executor that is running the command.
+ @updated				2026-10-19
+ */
+- (void) executorDidFinishExecuting: (ZIMDbBatchExecutor *)executor;
+
+@end
@@ -27,9 +27,16 @@
 	@protected
 		NSString *_dataSource;
 		NSMutableSet *_privileges;
-		NSLock *_mutex;
+		NSRecursiveLock *_mutex;
 		sqlite3 *_database;
 		BOOL _isConnected;
+		NSMutableDictionary *_statements;
+		NSMutableOrderedSet *_recentStatements;
+		NSDateFormatter *_dateFormatter;
+		NSInteger _changes;
+		NSCountedSet *_workload;
+		BOOL _isRecording;
+		NSString *_autoVacuum;
 
 }
 /*!
@@ -57,6 +64,16 @@
  @updated				2011-07-16
  */
 - (id) initWithDataSource: (NSString *)dataSource;
+/*!
+ @method				initInMemory
+ @discussion			This constructor creates an instance of this class with a private, in-memory
+						database and will attempt to open a database connection.  The database is
+						discarded when the connection is closed.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/inmemorydb.html
+ */
+- (id) initInMemory;
 /*!
  @method				open
  @discussion			This method will open a connection to the database.
@@ -82,6 +99,46 @@
  @see					http://code.google.com/p/sqlite-manager/issues/detail?id=34
  */
 - (NSNumber *) execute: (NSString *)sql;
+/*!
+ @method				execute:withParameters:
+ @discussion			This method will execute the specified SQL statement after binding the specified
+						values to its "?" placeholders.  The compiled statement is cached by this connection
+						so that executing a statement with the same shape only requires binding and stepping.
+						(Note: It is possible to execute multiple SQL statements via this method, in which
+						case the values are consumed by each statement in order.)
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @return				Either the last insert row id or TRUE.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/bind_blob.html
+ */
+- (NSNumber *) execute: (NSString *)sql withParameters: (NSArray *)parameters;
+/*!
+ @method				execute:withParameters:temporaryTables:
+ @discussion			This method will stage the specified values into an indexed temporary table and will
+						then execute the specified SQL statement after binding the specified values to its
+						"?" placeholders.  The staged values are cleared afterwards.
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @param tables			The values to be staged, keyed by their slot in the temporary table.
+ @return				Either the last insert row id or TRUE.
+ @updated				2026-10-19
+ */
+- (NSNumber *) execute: (NSString *)sql withParameters: (NSArray *)parameters temporaryTables: (NSDictionary *)tables;
+/*!
+ @method				execute:withParameters:returningAsObject:
+ @discussion			This method will execute the specified SQL statement, which should declare a
+						"RETURNING" clause, and will map each returned row to the specified model.  This
+						allows the rows changed by an insert, update, or delete statement (including any
+						defaults and trigger effects) to be read without a second query.
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @param model			The model to be used for mapping (e.g. NSMutableDictionary).
+ @return				The returned rows.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_returning.html
+ */
+- (NSArray *) execute: (NSString *)sql withParameters: (NSArray *)parameters returningAsObject: (Class)model;
 /*!
  @method				query:
  @discussion			This method will query with the specified SQL statement and will map
@@ -103,6 +160,41 @@
  @updated				2011-10-19
  */
 - (NSArray *) query: (NSString *)sql asObject: (Class)model;
+/*!
+ @method				query:withParameters:
+ @discussion			This method will query with the specified SQL statement after binding the specified
+						values to its "?" placeholders and will map each record to an NSDictionary.
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @return				The result set (i.e. an array of records).
+ @updated				2026-10-19
+ */
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters;
+/*!
+ @method				query:withParameters:asObject:
+ @discussion			This method will query with the specified SQL statement after binding the specified
+						values to its "?" placeholders and will map each record to the specified object
+						(i.e. model).  The compiled statement is cached by this connection.
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @param model			The class to used to map each record.
+ @return				The result set (i.e. an array of records).
+ @updated				2026-10-19
+ */
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters asObject: (Class)model;
+/*!
+ @method				query:withParameters:temporaryTables:asObject:
+ @discussion			This method will stage the specified values into an indexed temporary table and will
+						then query with the specified SQL statement after binding the specified values to its
+						"?" placeholders.  The staged values are cleared afterwards.
+ @param sql				The SQL statement to be used.
+ @param parameters		The values to be bound.
+ @param tables			The values to be staged, keyed by their slot in the temporary table.
+ @param model			The class to used to map each record.
+ @return				The result set (i.e. an array of records).
+ @updated				2026-10-19
+ */
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters temporaryTables: (NSDictionary *)tables asObject: (Class)model;
 /*!
  @method				rollbackTransaction
  @discussion			This method will rollback a transaction.
@@ -119,14 +211,131 @@
  @see					http://www.sqlite.org/lang_transaction.html
  */
 - (NSNumber *) commitTransaction;
+/*!
+ @method				isInTransaction
+ @discussion			This method checks whether a transaction is open on this connection.
+ @return				Indicates whether a transaction is open.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/get_autocommit.html
+ */
+- (BOOL) isInTransaction;
 /*!
  @method				vacuum
- @discussion			The method will rebuild the entire database.
+ @discussion			The method will rebuild the entire database.  Because the whole file is rewritten
+						(which needs up to twice its size in free disk space and blocks other connections
+						until it finishes), incrementalVacuum: should be preferred for large databases.
  @return				Whether the command was successfully executed.
- @updated				2011-06-30
+ @updated				2026-10-19
  @see					http://www.sqlite.org/lang_vacuum.html
  */
 - (NSNumber *) vacuum;
+/*!
+ @method				autoVacuum
+ @discussion			This method returns the database's auto-vacuum mode.
+ @return				The auto-vacuum mode (i.e. "NONE", "FULL", or "INCREMENTAL").
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_auto_vacuum
+ */
+- (NSString *) autoVacuum;
+/*!
+ @method				autoVacuum:
+ @discussion			This method will change the database's auto-vacuum mode.  A new database can also
+						be created in a given mode by setting "auto_vacuum" on its data source.  Because an
+						existing database can only be switched to or from "NONE" by rebuilding it, such a
+						change is followed by a one-time full vacuum.
+ @param mode			The auto-vacuum mode (i.e. "NONE", "FULL", or "INCREMENTAL").
+ @return				Whether the command was successfully executed.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_auto_vacuum
+ */
+- (NSNumber *) autoVacuum: (NSString *)mode;
+/*!
+ @method				incrementalVacuum:
+ @discussion			This method will move up to the specified number of pages from the freelist to
+						the end of the database file and truncate it.  It has no effect unless the
+						database's auto-vacuum mode is "INCREMENTAL".
+ @param pages			The maximum number of pages to be freed (0 frees the entire freelist).
+ @return				Whether the command was successfully executed.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_incremental_vacuum
+ */
+- (NSNumber *) incrementalVacuum: (NSUInteger)pages;
+/*!
+ @method				freelistRatio
+ @discussion			This method returns the fraction of the database's pages that are unused.
+ @return				The ratio of free pages to total pages.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_freelist_count
+ */
+- (double) freelistRatio;
+/*!
+ @method				needsIncrementalVacuum:
+ @discussion			This method checks whether the database is in "INCREMENTAL" auto-vacuum mode and
+						its freelist ratio has reached the specified threshold.
+ @param ratio			The ratio of free pages to total pages at which to vacuum.
+ @return				Whether incrementalVacuum: should be called.
+ @updated				2026-10-19
+ */
+- (BOOL) needsIncrementalVacuum: (double)ratio;
+/*!
+ @method				hasIndex:onTable:
+ @discussion			This method checks whether the specified index has been declared on the specified
+						table (e.g. before it is named in an "INDEXED BY" hint).  A table qualified with a
+						schema (e.g. "aux.table") is looked up in that schema's sqlite_master; otherwise,
+						both sqlite_master and sqlite_temp_master are checked.
+ @param index			The name of the index.
+ @param table			The name of the table, optionally qualified with a schema.
+ @return				Indicates whether the index exists.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/schematab.html
+ */
+- (BOOL) hasIndex: (NSString *)index onTable: (NSString *)table;
+/*!
+ @method				changes
+ @discussion			This method returns the number of rows that were inserted, updated, or deleted by
+						the last SQL statement that was executed or queried with this connection, including
+						the rows changed by its triggers and foreign key actions (but not those changed by
+						staging temporary tables).
+ @return				The number of rows that were changed.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/total_changes.html
+ */
+- (NSInteger) changes;
+/*!
+ @method				totalChanges
+ @discussion			This method returns the number of rows that have been inserted, updated, or deleted
+						in this connection's data source through any connection in this process (e.g. those
+						opened by ORM models).  Changes made by other processes are not counted.
+ @return				The number of rows that have been changed.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/total_changes.html
+ */
+- (NSInteger) totalChanges;
+/*!
+ @method				recordWorkload:
+ @discussion			This method will start (or stop) recording each distinct SQL statement that is
+						executed or queried with this connection (e.g. so that the workload can be given
+						to an index advisor).  Statements that were already recorded are kept until
+						clearWorkload is called.  Once ZIMDbWorkloadSize distinct statements have been
+						recorded, only those statements continue to be counted.
+ @param record			Whether SQL statements should be recorded.
+ @updated				2026-10-19
+ */
+- (void) recordWorkload: (BOOL)record;
+/*!
+ @method				workload
+ @discussion			This method will return the SQL statements that have been recorded.  Use
+						countForObject: to find how many times a statement was run.
+ @return				The SQL statements that have been recorded.
+ @updated				2026-10-19
+ */
+- (NSCountedSet *) workload;
+/*!
+ @method				clearWorkload
+ @discussion			This method will discard the SQL statements that have been recorded.
+ @updated				2026-10-19
+ */
+- (void) clearWorkload;
 /*!
  @method				isConnected
  @discussion			This method checks whether a database connection currently exists.
@@ -16,6 +16,36 @@
 
 #import "NSString+ZIMString.h"
 #import "ZIMDbConnection.h"
+#import "ZIMSqlExpression.h"
+
+/*!
+ @function				ZIMDbConnectionCountChanges
+ @discussion			This function will add to (and return) the number of rows that have been changed
+						in the specified data source through any of this process's connections.  Every
+						connection writes through execute: or query:, so a pooled connection can see the
+						changes made by another (e.g. the one an ORM model opened).
+ @param dataSource		The data source that was changed.
+ @param changes			The number of rows that were changed.
+ @return				The number of rows that have been changed in the data source.
+ @updated				2026-10-19
+ */
+static NSInteger ZIMDbConnectionCountChanges(NSString *dataSource, NSInteger changes) {
+	static NSMutableDictionary *counts = nil;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		counts = [[NSMutableDictionary alloc] init];
+	});
+	if (dataSource == nil) {
+		return 0;
+	}
+	@synchronized(counts) {
+		NSInteger count = [[counts objectForKey: dataSource] integerValue] + changes;
+		if (changes != 0) {
+			[counts setObject: [NSNumber numberWithInteger: count] forKey: dataSource];
+		}
+		return count;
+	}
+}
 
 /*!
  @category		ZIMDbConnection (Private)
@@ -52,6 +82,81 @@
  @updated			2011-10-19
  */
 - (id) columnValueAtIndex: (int)column withColumnType: (int)columnType inStatement: (sqlite3_stmt *)statement;
+/*!
+ @method			bindParameters:atOffset:toStatement:
+ @discussion		This method will bind the values, starting at the specified offset, to the
+					placeholders in the prepared SQL statement.
+ @param parameters	The values to be bound.
+ @param offset		The index of the first value to be bound.
+ @param statement	The prepared SQL statement.
+ @return			The result code of the binding.
+ @updated			2026-10-19
+ @see				http://www.sqlite.org/c3ref/bind_blob.html
+ */
+- (int) bindParameters: (NSArray *)parameters atOffset: (NSUInteger)offset toStatement: (sqlite3_stmt *)statement;
+/*!
+ @method			cacheStatements:forSql:
+ @discussion		This method will cache the prepared SQL statements so that they can be reused.
+ @param statements	The prepared SQL statements (i.e. wrapped in NSValue objects).
+ @param sql			The SQL statement that was prepared.
+ @updated			2026-10-19
+ */
+- (void) cacheStatements: (NSArray *)statements forSql: (NSString *)sql;
+/*!
+ @method			cachedStatementsForSql:
+ @discussion		This method will return the prepared SQL statements cached for the SQL statement and
+					will mark them as the most recently used.
+ @param sql			The SQL statement that was prepared.
+ @return			The prepared SQL statements or nil if none are cached.
+ @updated			2026-10-19
+ */
+- (NSArray *) cachedStatementsForSql: (NSString *)sql;
+/*!
+ @method			uncacheStatementsForSql:
+ @discussion		This method will remove the prepared SQL statements cached for the SQL statement
+					without finalizing them.
+ @param sql			The SQL statement that was prepared.
+ @updated			2026-10-19
+ */
+- (void) uncacheStatementsForSql: (NSString *)sql;
+/*!
+ @method			dateFormatter
+ @discussion		This method will return the formatter used to bind and read dates, which is created
+					only once per connection.
+ @return			The date formatter.
+ @updated			2026-10-19
+ */
+- (NSDateFormatter *) dateFormatter;
+/*!
+ @method			finalizeStatements:
+ @discussion		This method will finalize the specified prepared SQL statements.
+ @param statements	The prepared SQL statements (i.e. wrapped in NSValue objects).
+ @updated			2026-10-19
+ */
+- (void) finalizeStatements: (NSArray *)statements;
+/*!
+ @method			stageTemporaryTables:
+ @discussion		This method will create (if necessary) the connection's indexed temporary table and
+					will populate a slot in it for each list of values.
+ @param tables		The values to be staged, keyed by slot.
+ @updated			2026-10-19
+ */
+- (void) stageTemporaryTables: (NSDictionary *)tables;
+/*!
+ @method			clearTemporaryTables:
+ @discussion		This method will remove the values staged in the specified slots.
+ @param tables		The values that were staged, keyed by slot.
+ @updated			2026-10-19
+ */
+- (void) clearTemporaryTables: (NSDictionary *)tables;
+/*!
+ @method			recordStatement:
+ @discussion		This method will add the SQL statement to the workload, unless the workload already
+					holds as many distinct SQL statements as it may.
+ @param sql			The SQL statement that was run.
+ @updated			2026-10-19
+ */
+- (void) recordStatement: (NSString *)sql;
 @end
 
 @implementation ZIMDbConnection
@@ -64,6 +169,14 @@
     #define ZIMDbPropertyList @"db.plist" // Override this pre-processing instruction in your <project-name>_Prefix.pch
 #endif
 
+#if !defined(ZIMDbStatementCacheSize)
+    #define ZIMDbStatementCacheSize 64 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbWorkloadSize)
+    #define ZIMDbWorkloadSize 1024 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
 - (id) initWithDataSource: (NSString *)dataSource withMultithreadingSupport: (BOOL)multithreading {
 	if ((self = [super init])) {
 		NSString *plist = [[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent: ZIMDbPropertyList];
@@ -88,6 +201,13 @@
             }
         }
         _dataSource = [workingPath copy];
+        NSString *autoVacuum = [config objectForKey: @"auto_vacuum"];
+        if (autoVacuum != nil) {
+            _autoVacuum = [autoVacuum uppercaseString];
+            if (![[NSSet setWithObjects: @"NONE", @"FULL", @"INCREMENTAL", nil] containsObject: _autoVacuum]) {
+                @throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to load data source." userInfo: nil];
+            }
+        }
         NSArray *privileges = [config objectForKey: @"privileges"];
         if (privileges != nil) {
             _privileges = [[NSMutableSet alloc] init];
@@ -99,8 +219,12 @@
             [_privileges addObject: @"COMMIT"];
         }
 		if (multithreading) {
-			_mutex = [[NSLock alloc] init];
+			_mutex = [[NSRecursiveLock alloc] init]; // i.e. staging temporary tables re-enters the lock
 		}
+		_statements = [[NSMutableDictionary alloc] init];
+		_recentStatements = [[NSMutableOrderedSet alloc] init];
+		_dateFormatter = nil;
+		_changes = 0;
 		[self open];
 	}
 	return self;
@@ -110,6 +234,18 @@
 	return [self initWithDataSource: dataSource withMultithreadingSupport: NO];
 }
 
+- (id) initInMemory {
+	if ((self = [super init])) {
+		_dataSource = @":memory:";
+		_statements = [[NSMutableDictionary alloc] init];
+		_recentStatements = [[NSMutableOrderedSet alloc] init];
+		_dateFormatter = nil;
+		_changes = 0;
+		[self open];
+	}
+	return self;
+}
+
 - (void) open {
 	@synchronized(self) {
 		if (!_isConnected) {
@@ -117,6 +253,10 @@
 				sqlite3_close(_database);
 				@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to open database connection. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
 			}
+			if (_autoVacuum != nil) { // Note: Only takes effect on a new database; see autoVacuum: for existing databases.
+				NSString *sql = [NSString stringWithFormat: @"PRAGMA auto_vacuum = %@;", _autoVacuum];
+				sqlite3_exec(_database, [sql UTF8String], NULL, NULL, NULL);
+			}
 			_isConnected = YES;
 		}
 	}
@@ -140,6 +280,12 @@
 		@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to execute SQL statement because privileges have been restricted." userInfo: nil];
 	}
 
+	if (_isRecording) {
+		[self recordStatement: sql];
+	}
+
+	int changes = sqlite3_total_changes(_database);
+
 	//sqlite3_stmt *statement = NULL;
 
 	//if ((sqlite3_prepare_v2(_database, [sql UTF8String], -1, &statement, NULL) != SQLITE_OK) || (sqlite3_step(statement) != SQLITE_DONE)) {
@@ -151,11 +297,14 @@
 		@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to execute SQL statement. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
 	}
 
+	_changes = sqlite3_total_changes(_database) - changes;
+	ZIMDbConnectionCountChanges(_dataSource, _changes);
+
 	NSNumber *result = nil;
 
 	if ([command isEqualToString: @"INSERT"]) {
 	 	// Known limitations: http://www.sqlite.org/c3ref/last_insert_rowid.html
-		result = [NSNumber numberWithInt: sqlite3_last_insert_rowid(_database)];
+		result = [NSNumber numberWithLongLong: sqlite3_last_insert_rowid(_database)];
 	}
 	else {
 		result = [NSNumber numberWithBool: YES];
@@ -170,11 +319,143 @@
 	return result;
 }
 
+- (NSNumber *) execute: (NSString *)sql withParameters: (NSArray *)parameters {
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+
+	NSString *command = [[NSString firstTokenInString: sql scanUpToCharactersFromSet: [NSCharacterSet characterSetWithCharactersInString: @" ;\"'`[]\n\r\t"]] uppercaseString];
+
+	if ((_privileges != nil) && ![_privileges containsObject: command]) {
+		if (_mutex != nil) {
+			[_mutex unlock];
+		}
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to execute SQL statement because privileges have been restricted." userInfo: nil];
+	}
+
+	if (_isRecording) {
+		[self recordStatement: sql];
+	}
+
+	int changes = sqlite3_total_changes(_database);
+
+	NSArray *statements = [self cachedStatementsForSql: sql];
+	BOOL isCached = (statements != nil);
+	if (!isCached) {
+		statements = [[NSMutableArray alloc] init];
+	}
+
+	const char *tail = [sql UTF8String];
+	NSUInteger offset = 0;
+	NSUInteger index = 0;
+
+	while (YES) {
+		sqlite3_stmt *statement = NULL;
+		if (isCached) {
+			if (index >= [statements count]) {
+				break;
+			}
+			statement = (sqlite3_stmt *)[[statements objectAtIndex: index] pointerValue];
+		}
+		else {
+			if ((tail == NULL) || (*tail == '\0')) {
+				break;
+			}
+			if (sqlite3_prepare_v2(_database, tail, -1, &statement, &tail) != SQLITE_OK) {
+				[self finalizeStatements: statements];
+				if (_mutex != nil) {
+					[_mutex unlock];
+				}
+				@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to execute SQL statement. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
+			}
+			if (statement == NULL) { // i.e. trailing whitespace or comment
+				continue;
+			}
+			[(NSMutableArray *)statements addObject: [NSValue valueWithPointer: statement]];
+		}
+		index++;
+
+		int result = [self bindParameters: parameters atOffset: offset toStatement: statement];
+		if (result == SQLITE_OK) {
+			offset += sqlite3_bind_parameter_count(statement);
+			while ((result = sqlite3_step(statement)) == SQLITE_ROW);
+		}
+		sqlite3_reset(statement);
+		sqlite3_clear_bindings(statement);
+
+		if (result != SQLITE_DONE) {
+			if (isCached) {
+				[self uncacheStatementsForSql: sql];
+			}
+			[self finalizeStatements: statements];
+			if (_mutex != nil) {
+				[_mutex unlock];
+			}
+			if ((result == SQLITE_RANGE) || (result == SQLITE_MISMATCH)) {
+				@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to execute SQL statement because the values could not be bound to its placeholders." userInfo: nil];
+			}
+			@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to execute SQL statement. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
+		}
+	}
+
+	if (!isCached) {
+		[self cacheStatements: statements forSql: sql];
+	}
+
+	_changes = sqlite3_total_changes(_database) - changes;
+	ZIMDbConnectionCountChanges(_dataSource, _changes);
+
+	NSNumber *result = nil;
+
+	if ([command isEqualToString: @"INSERT"]) {
+		result = [NSNumber numberWithLongLong: sqlite3_last_insert_rowid(_database)];
+	}
+	else {
+		result = [NSNumber numberWithBool: YES];
+	}
+
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+
+	return result;
+}
+
+- (NSNumber *) execute: (NSString *)sql withParameters: (NSArray *)parameters temporaryTables: (NSDictionary *)tables {
+	// Note: The lock is held from staging through clearing so that another thread cannot read or clear the
+	// staged values in between.
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	@try {
+		[self stageTemporaryTables: tables];
+		@try {
+			return [self execute: sql withParameters: parameters];
+		}
+		@finally {
+			[self clearTemporaryTables: tables];
+		}
+	}
+	@finally {
+		if (_mutex != nil) {
+			[_mutex unlock];
+		}
+	}
+}
+
 - (NSArray *) query: (NSString *)sql {
-	return [self query: sql asObject: [NSMutableDictionary class]];
+	return [self query: sql withParameters: nil asObject: [NSMutableDictionary class]];
 }
 
 - (NSArray *) query: (NSString *)sql asObject: (Class)model {
+	return [self query: sql withParameters: nil asObject: model];
+}
+
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters {
+	return [self query: sql withParameters: parameters asObject: [NSMutableDictionary class]];
+}
+
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters asObject: (Class)model {
 	if (_mutex != nil) {
 		[_mutex lock];
 	}
@@ -188,9 +469,19 @@
 		@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to perform query with SQL statement because privileges have been restricted." userInfo: nil];
 	}
 
+	if (_isRecording) {
+		[self recordStatement: sql];
+	}
+
 	sqlite3_stmt *statement = NULL;
-	
-	if (sqlite3_prepare_v2(_database, [sql UTF8String], -1, &statement, NULL) != SQLITE_OK) {
+	int changes = sqlite3_total_changes(_database); // i.e. a statement with a returning clause
+
+	NSArray *statements = (parameters != nil) ? [self cachedStatementsForSql: sql] : nil;
+
+	if (statements != nil) {
+		statement = (sqlite3_stmt *)[[statements objectAtIndex: 0] pointerValue];
+	}
+	else if (sqlite3_prepare_v2(_database, [sql UTF8String], -1, &statement, NULL) != SQLITE_OK) {
 		sqlite3_finalize(statement);
 		
 		if (_mutex != nil) {
@@ -199,6 +490,20 @@
 		
 		@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to perform query with SQL statement. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
 	}
+	else if (parameters != nil) {
+		statements = [NSArray arrayWithObject: [NSValue valueWithPointer: statement]];
+		[self cacheStatements: statements forSql: sql];
+	}
+
+	if ((parameters != nil) && ([self bindParameters: parameters atOffset: 0 toStatement: statement] != SQLITE_OK)) {
+		sqlite3_clear_bindings(statement);
+
+		if (_mutex != nil) {
+			[_mutex unlock];
+		}
+
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Failed to perform query with SQL statement because the values could not be bound to its placeholders." userInfo: nil];
+	}
 
 	NSMutableArray *columnNames = [[NSMutableArray alloc] init];
 	NSMutableArray *columnTypes = [[NSMutableArray alloc] init];
@@ -208,7 +513,9 @@
 	
 	NSMutableArray *records = [[NSMutableArray alloc] init];
 	
-	while (sqlite3_step(statement) == SQLITE_ROW) {
+	int result;
+
+	while ((result = sqlite3_step(statement)) == SQLITE_ROW) {
 		id record = [[model alloc] init];
 
 		if (doFetchColumnInfo) {
@@ -217,7 +524,13 @@
 			for (int index = 0; index < columnCount; index++) {
 				NSString *columnName = [NSString stringWithUTF8String: sqlite3_column_name(statement, index)];
 				if (!([record isKindOfClass: [NSMutableDictionary class]] || [record respondsToSelector: [self selectorForSettingColumnName: columnName]])) {
-					sqlite3_finalize(statement);
+					if (statements != nil) {
+						sqlite3_reset(statement);
+						sqlite3_clear_bindings(statement);
+					}
+					else {
+						sqlite3_finalize(statement);
+					}
 					
 					if (_mutex != nil) {
 						[_mutex unlock];
@@ -244,7 +557,33 @@
 		[records addObject: record];
 	}
 
-	sqlite3_finalize(statement);
+	if (result != SQLITE_DONE) { // e.g. a constraint violation raised by a statement with a returning clause
+		NSString *reason = [NSString stringWithFormat: @"Failed to perform query with SQL statement. '%S'", sqlite3_errmsg16(_database)];
+		if (statements != nil) {
+			sqlite3_reset(statement);
+			sqlite3_clear_bindings(statement);
+		}
+		else {
+			sqlite3_finalize(statement);
+		}
+
+		if (_mutex != nil) {
+			[_mutex unlock];
+		}
+
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: reason userInfo: nil];
+	}
+
+	if (statements != nil) {
+		sqlite3_reset(statement);
+		sqlite3_clear_bindings(statement);
+	}
+	else {
+		sqlite3_finalize(statement);
+	}
+
+	_changes = sqlite3_total_changes(_database) - changes;
+	ZIMDbConnectionCountChanges(_dataSource, _changes);
 
 	if (_mutex != nil) {
 		[_mutex unlock];
@@ -253,6 +592,32 @@
 	return records;
 }
 
+- (NSArray *) execute: (NSString *)sql withParameters: (NSArray *)parameters returningAsObject: (Class)model {
+	// Note: A statement with a returning clause yields its rows like a query; an empty array of parameters
+	// still caches the compiled statement.
+	return [self query: sql withParameters: (parameters != nil) ? parameters : [NSArray array] asObject: model];
+}
+
+- (NSArray *) query: (NSString *)sql withParameters: (NSArray *)parameters temporaryTables: (NSDictionary *)tables asObject: (Class)model {
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	@try {
+		[self stageTemporaryTables: tables];
+		@try {
+			return [self query: sql withParameters: parameters asObject: model];
+		}
+		@finally {
+			[self clearTemporaryTables: tables];
+		}
+	}
+	@finally {
+		if (_mutex != nil) {
+			[_mutex unlock];
+		}
+	}
+}
+
 - (SEL) selectorForSettingColumnName: (NSString *)column {
 	return NSSelectorFromString([NSString stringWithFormat: @"set%@:", [NSString capitalizeFirstCharacterInString: column]]);
 }
@@ -302,7 +667,7 @@
 
 - (id) columnValueAtIndex: (int)column withColumnType: (int)columnType inStatement: (sqlite3_stmt *)statement {
 	if (columnType == SQLITE_INTEGER) {
-		return [NSNumber numberWithInt: sqlite3_column_int(statement, column)];
+		return [NSNumber numberWithLongLong: sqlite3_column_int64(statement, column)];
 	}
 	if (columnType == SQLITE_FLOAT) {
 		return [[NSDecimalNumber alloc] initWithDouble: sqlite3_column_double(statement, column)];
@@ -319,15 +684,178 @@
 	if (columnType == SQLITE_DATE) {
 		const char *text = (const char *)sqlite3_column_text(statement, column);
 		if (text != NULL) {
-			NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
-			[formatter setDateFormat: @"yyyy-MM-dd HH:mm:ss"];
-			NSDate *date = [formatter dateFromString: [NSString stringWithUTF8String: text]];
-			return date;
+			return [[self dateFormatter] dateFromString: [NSString stringWithUTF8String: text]];
 		}
 	}
 	return [NSNull null];
 }
 
+- (int) bindParameters: (NSArray *)parameters atOffset: (NSUInteger)offset toStatement: (sqlite3_stmt *)statement {
+	int count = sqlite3_bind_parameter_count(statement);
+	if ((offset + count) > [parameters count]) {
+		return SQLITE_RANGE;
+	}
+	for (int index = 1; index <= count; index++) {
+		id value = [parameters objectAtIndex: offset + index - 1];
+		int result;
+		if ((value == nil) || [value isKindOfClass: [NSNull class]]) {
+			result = sqlite3_bind_null(statement, index);
+		}
+		else if ([value isKindOfClass: [NSNumber class]]) {
+			const char *type = [(NSNumber *)value objCType];
+			if ((strcmp(type, @encode(double)) == 0) || (strcmp(type, @encode(float)) == 0)) {
+				result = sqlite3_bind_double(statement, index, [(NSNumber *)value doubleValue]);
+			}
+			else {
+				result = sqlite3_bind_int64(statement, index, [(NSNumber *)value longLongValue]);
+			}
+		}
+		else if ([value isKindOfClass: [NSString class]]) {
+			result = sqlite3_bind_text(statement, index, [(NSString *)value UTF8String], -1, SQLITE_TRANSIENT);
+		}
+		else if ([value isKindOfClass: [NSData class]]) {
+			NSUInteger length = [(NSData *)value length];
+			result = (length <= INT_MAX) ? sqlite3_bind_blob(statement, index, [(NSData *)value bytes], (int)length, SQLITE_TRANSIENT) : SQLITE_TOOBIG;
+		}
+		else if ([value isKindOfClass: [NSDate class]]) {
+			result = sqlite3_bind_text(statement, index, [[[self dateFormatter] stringFromDate: (NSDate *)value] UTF8String], -1, SQLITE_TRANSIENT);
+		}
+		else {
+			result = SQLITE_MISMATCH;
+		}
+		if (result != SQLITE_OK) {
+			return result;
+		}
+	}
+	return SQLITE_OK;
+}
+
+- (void) cacheStatements: (NSArray *)statements forSql: (NSString *)sql {
+	if ([_statements count] >= ZIMDbStatementCacheSize) { // i.e. evicts the least recently used statements
+		NSString *key = [_recentStatements objectAtIndex: 0];
+		[self finalizeStatements: [_statements objectForKey: key]];
+		[self uncacheStatementsForSql: key];
+	}
+	[_statements setObject: statements forKey: sql];
+	[_recentStatements addObject: sql];
+}
+
+- (NSArray *) cachedStatementsForSql: (NSString *)sql {
+	NSArray *statements = [_statements objectForKey: sql];
+	if (statements != nil) {
+		NSUInteger index = [_recentStatements indexOfObject: sql];
+		NSUInteger last = [_recentStatements count] - 1;
+		if (index < last) {
+			[_recentStatements moveObjectsAtIndexes: [NSIndexSet indexSetWithIndex: index] toIndex: last];
+		}
+	}
+	return statements;
+}
+
+- (void) uncacheStatementsForSql: (NSString *)sql {
+	[_statements removeObjectForKey: sql];
+	[_recentStatements removeObject: sql];
+}
+
+- (NSDateFormatter *) dateFormatter {
+	if (_dateFormatter == nil) {
+		_dateFormatter = [[NSDateFormatter alloc] init];
+		[_dateFormatter setDateFormat: @"yyyy-MM-dd HH:mm:ss"];
+	}
+	return _dateFormatter;
+}
+
+- (void) finalizeStatements: (NSArray *)statements {
+	for (NSValue *statement in statements) {
+		sqlite3_finalize((sqlite3_stmt *)[statement pointerValue]);
+	}
+}
+
+- (void) stageTemporaryTables: (NSDictionary *)tables {
+	if ([tables count] == 0) {
+		return;
+	}
+
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+
+	NSString *error = nil;
+
+	int result = sqlite3_exec(_database, "SAVEPOINT zim_staging; CREATE TEMP TABLE IF NOT EXISTS zim_in (slot INTEGER NOT NULL, value, PRIMARY KEY (slot, value));", NULL, NULL, NULL);
+
+	sqlite3_stmt *statement = NULL;
+	if (result == SQLITE_OK) {
+		result = sqlite3_prepare_v2(_database, "INSERT OR IGNORE INTO temp.zim_in (slot, value) VALUES (?, ?);", -1, &statement, NULL);
+	}
+
+	for (NSNumber *slot in tables) {
+		if (result != SQLITE_OK) {
+			break;
+		}
+		if (![slot isKindOfClass: [NSNumber class]]) {
+			error = [NSString stringWithFormat: @"Invalid temporary table slot provided. '%@'", slot];
+			result = SQLITE_MISUSE;
+			break;
+		}
+		result = sqlite3_exec(_database, [[NSString stringWithFormat: @"DELETE FROM temp.zim_in WHERE slot = %lld;", [slot longLongValue]] UTF8String], NULL, NULL, NULL);
+		for (id value in [tables objectForKey: slot]) {
+			if (result != SQLITE_OK) {
+				break;
+			}
+			result = [self bindParameters: [NSArray arrayWithObjects: slot, value, nil] atOffset: 0 toStatement: statement];
+			if (result == SQLITE_OK) {
+				result = sqlite3_step(statement);
+				if (result == SQLITE_DONE) {
+					result = SQLITE_OK;
+				}
+			}
+			sqlite3_reset(statement);
+		}
+	}
+	sqlite3_finalize(statement);
+
+	if (result == SQLITE_OK) {
+		result = sqlite3_exec(_database, "RELEASE zim_staging;", NULL, NULL, NULL);
+	}
+	else {
+		if (error == nil) {
+			error = [NSString stringWithFormat: @"%S", sqlite3_errmsg16(_database)];
+		}
+		sqlite3_exec(_database, "ROLLBACK TO zim_staging; RELEASE zim_staging;", NULL, NULL, NULL);
+	}
+
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+
+	if (result != SQLITE_OK) {
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to stage temporary table. '%@'", (error != nil) ? error : [NSString stringWithFormat: @"%S", sqlite3_errmsg16(_database)]] userInfo: nil];
+	}
+}
+
+- (void) clearTemporaryTables: (NSDictionary *)tables {
+	if ([tables count] == 0) {
+		return;
+	}
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	for (NSNumber *slot in tables) {
+		NSString *sql = [NSString stringWithFormat: @"DELETE FROM temp.zim_in WHERE slot = %lld;", [slot longLongValue]];
+		sqlite3_exec(_database, [sql UTF8String], NULL, NULL, NULL);
+	}
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+}
+
+- (void) recordStatement: (NSString *)sql {
+	if (([_workload count] < ZIMDbWorkloadSize) || ([_workload countForObject: sql] > 0)) {
+		[_workload addObject: sql];
+	}
+}
+
 - (NSNumber *) rollbackTransaction {
 	return [self execute: @"ROLLBACK TRANSACTION;"];
 }
@@ -336,10 +864,122 @@
 	return [self execute: @"COMMIT TRANSACTION;"];
 }
 
+- (BOOL) isInTransaction {
+	return (_isConnected && (sqlite3_get_autocommit(_database) == 0));
+}
+
 - (NSNumber *) vacuum {
 	return [self execute: @"VACUUM;"];
 }
 
+- (NSString *) autoVacuum {
+	NSArray *records = [self query: @"PRAGMA auto_vacuum;"]; // Note: Table-valued pragma functions require SQLite 3.16.0.
+	NSInteger mode = ([records count] > 0) ? [[[records objectAtIndex: 0] objectForKey: @"auto_vacuum"] integerValue] : 0;
+	switch (mode) {
+		case 1:
+			return @"FULL";
+		case 2:
+			return @"INCREMENTAL";
+		default:
+			return @"NONE";
+	}
+}
+
+- (NSNumber *) autoVacuum: (NSString *)mode {
+	mode = [mode uppercaseString];
+	if (![[NSSet setWithObjects: @"NONE", @"FULL", @"INCREMENTAL", nil] containsObject: mode]) {
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Invalid auto-vacuum mode declared. '%@'", mode] userInfo: nil];
+	}
+	NSString *current = [self autoVacuum];
+	if ([current isEqualToString: mode]) {
+		return [NSNumber numberWithBool: YES];
+	}
+	NSNumber *result = [self execute: [NSString stringWithFormat: @"PRAGMA auto_vacuum = %@;", mode]];
+	if ([current isEqualToString: @"NONE"] || [mode isEqualToString: @"NONE"]) {
+		result = [self vacuum];
+	}
+	return result;
+}
+
+- (NSNumber *) incrementalVacuum: (NSUInteger)pages {
+	return [self execute: [NSString stringWithFormat: @"PRAGMA incremental_vacuum(%lu);", (unsigned long)pages]];
+}
+
+- (double) freelistRatio {
+	NSArray *freelist = [self query: @"PRAGMA freelist_count;"];
+	NSArray *pages = [self query: @"PRAGMA page_count;"];
+	if (([freelist count] == 0) || ([pages count] == 0)) {
+		return 0.0;
+	}
+	double pageCount = [[[pages objectAtIndex: 0] objectForKey: @"page_count"] doubleValue];
+	return (pageCount > 0.0) ? ([[[freelist objectAtIndex: 0] objectForKey: @"freelist_count"] doubleValue] / pageCount) : 0.0;
+}
+
+- (BOOL) needsIncrementalVacuum: (double)ratio {
+	return ([[self autoVacuum] isEqualToString: @"INCREMENTAL"] && ([self freelistRatio] >= ratio));
+}
+
+- (BOOL) hasIndex: (NSString *)index onTable: (NSString *)table {
+	NSCharacterSet *quotes = [NSCharacterSet characterSetWithCharactersInString: @" \"'`[]"];
+	NSString *schema = nil;
+	NSRange dot = [table rangeOfString: @"." options: NSBackwardsSearch];
+	if (dot.location != NSNotFound) {
+		schema = [[table substringToIndex: dot.location] stringByTrimmingCharactersInSet: quotes];
+		table = [table substringFromIndex: dot.location + 1];
+	}
+	table = [table stringByTrimmingCharactersInSet: quotes];
+	NSString *master = @"(SELECT type, name, tbl_name FROM sqlite_master UNION ALL SELECT type, name, tbl_name FROM sqlite_temp_master)"; // i.e. an unqualified name may resolve to a temporary table
+	if (schema != nil) {
+		master = [NSString stringWithFormat: @"%@.sqlite_master", [ZIMSqlExpression prepareIdentifier: schema maxCount: 1]];
+	}
+	NSString *sql = [NSString stringWithFormat: @"SELECT 1 AS [found] FROM %@ WHERE type = 'index' AND name = ? COLLATE NOCASE AND tbl_name = ? COLLATE NOCASE LIMIT 1;", master];
+	NSArray *parameters = [NSArray arrayWithObjects: index, table, nil];
+	NSArray *records = [self query: sql withParameters: parameters];
+	return ([records count] > 0);
+}
+
+- (NSInteger) changes {
+	return _changes;
+}
+
+- (NSInteger) totalChanges {
+	return ZIMDbConnectionCountChanges(_dataSource, 0);
+}
+
+- (void) recordWorkload: (BOOL)record {
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	if (record && (_workload == nil)) {
+		_workload = [[NSCountedSet alloc] init];
+	}
+	_isRecording = record;
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+}
+
+- (NSCountedSet *) workload {
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	NSCountedSet *workload = (_workload != nil) ? [_workload copy] : [[NSCountedSet alloc] init];
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+	return workload;
+}
+
+- (void) clearWorkload {
+	if (_mutex != nil) {
+		[_mutex lock];
+	}
+	[_workload removeAllObjects];
+	if (_mutex != nil) {
+		[_mutex unlock];
+	}
+}
+
 - (BOOL) isConnected {
 	return _isConnected;
 }
@@ -347,6 +987,11 @@
 - (void) close {
 	@synchronized(self) {
 		if (_isConnected) {
+			for (NSString *sql in _statements) {
+				[self finalizeStatements: [_statements objectForKey: sql]];
+			}
+			[_statements removeAllObjects];
+			[_recentStatements removeAllObjects];
 			if (sqlite3_close(_database) != SQLITE_OK) {
 				@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to close database connection. '%S'", sqlite3_errmsg16(_database)] userInfo: nil];
 			}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import "ZIMSqlCreateIndexStatement.h"
+
+@class ZIMDbConnection;
+
+/*!
+ @class					ZIMDbIndexAdvisor
+ @discussion			This class recommends indexes for a workload of SQL statements.  The columns that
+						each statement filters, joins, or sorts on are turned into candidate indexes, which
+						are then tried one at a time on an in-memory copy of the database's schema (and its
+						statistics).  A candidate is recommended only when "EXPLAIN QUERY PLAN" shows that
+						SQLite would choose it.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/cli.html#index_recommendations_sqlite_expert_
+ */
+@interface ZIMDbIndexAdvisor : NSObject {
+
+	@protected
+		ZIMDbConnection *_connection;
+		NSCountedSet *_workload;
+		NSMutableArray *_recommendations;
+		NSMutableDictionary *_improvements;
+
+}
+/*!
+ @method				initWithConnection:
+ @discussion			This constructor creates an instance of this class that will read the schema from
+						the specified connection.  The database itself is never changed.
+ @param connection		The connection to be used.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithConnection: (ZIMDbConnection *)connection;
+/*!
+ @method				statement:
+ @discussion			This method will add the specified SQL statement to the workload.
+ @param statement		The SQL statement to be added (i.e. either a string or an object that
+						conforms to ZIMSqlStatement).
+ @updated				2026-10-19
+ */
+- (void) statement: (id)statement;
+/*!
+ @method				statements:
+ @discussion			This method will add the specified SQL statements to the workload (e.g. the
+						workload recorded by a connection).
+ @param statements		The SQL statements to be added.
+ @updated				2026-10-19
+ */
+- (void) statements: (id<NSFastEnumeration>)statements;
+/*!
+ @method				recommend
+ @discussion			This method will analyze the workload and recommend indexes.  The recommendations
+						are sorted so that the index which improves the most statements comes first.
+ @return				The "CREATE INDEX" statements that are recommended.
+ @updated				2026-10-19
+ */
+- (NSArray *) recommend;
+/*!
+ @method				statementsImprovedBy:
+ @discussion			This method will return the SQL statements in the workload that would use the
+						specified recommendation.
+ @param index			A recommendation that was returned by recommend.
+ @return				The SQL statements that would be improved.
+ @updated				2026-10-19
+ */
+- (NSArray *) statementsImprovedBy: (ZIMSqlCreateIndexStatement *)index;
+
+@end
@@ -0,0 +1,396 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "NSString+ZIMString.h"
+#import "ZIMDbConnection.h"
+#import "ZIMDbIndexAdvisor.h"
+#import "ZIMDbQueryPlan.h"
+#import "ZIMSqlDropIndexStatement.h"
+#import "ZIMSqlExpression.h"
+#import "ZIMSqlTokenizer.h"
+
+/*!
+ @category		ZIMDbIndexAdvisor (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMDbIndexAdvisor (Private)
+/*!
+ @method			copySchema
+ @discussion		This method will copy the schema and statistics of the database into an in-memory
+					database.
+ @return			A connection to the in-memory database.
+ @updated			2026-10-19
+ */
+- (ZIMDbConnection *) copySchema;
+/*!
+ @method			columnsOfTable:connection:
+ @discussion		This method will return the columns of the specified table, keyed by their
+					lowercase names.
+ @param table		The table to be described.
+ @param connection	The connection to be used.
+ @return			The columns of the table.
+ @updated			2026-10-19
+ */
+- (NSDictionary *) columnsOfTable: (NSString *)table connection: (ZIMDbConnection *)connection;
+/*!
+ @method			candidatesForColumns:inStatement:
+ @discussion		This method will derive candidate indexes from the columns that the statement
+					compares for equality, compares by range, and sorts on (in that order).
+ @param columns		The columns of the table, keyed by their lowercase names.
+ @param tokenizer	The tokenized SQL statement.
+ @return			The candidates, each being a list of [column, descending] pairs.
+ @updated			2026-10-19
+ */
+- (NSArray *) candidatesForColumns: (NSDictionary *)columns inStatement: (ZIMSqlTokenizer *)tokenizer;
+/*!
+ @method			isCandidate:coveredOnTable:connection:
+ @discussion		This method checks whether an existing index already begins with the candidate's
+					columns.
+ @param candidate	The candidate to be checked.
+ @param table		The table to be checked.
+ @param connection	The connection to be used.
+ @return			Indicates whether the candidate is redundant.
+ @updated			2026-10-19
+ */
+- (BOOL) isCandidate: (NSArray *)candidate coveredOnTable: (NSString *)table connection: (ZIMDbConnection *)connection;
+/*!
+ @method			indexForCandidate:onTable:
+ @discussion		This method will make a "CREATE INDEX" statement for the candidate.
+ @param candidate	The candidate to be used.
+ @param table		The table to be indexed.
+ @return			The "CREATE INDEX" statement.
+ @updated			2026-10-19
+ */
+- (ZIMSqlCreateIndexStatement *) indexForCandidate: (NSArray *)candidate onTable: (NSString *)table;
+@end
+
+@implementation ZIMDbIndexAdvisor
+
+#if !defined(ZIMDbIndexAdvisorMaxColumns)
+    #define ZIMDbIndexAdvisorMaxColumns 4 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+- (id) initWithConnection: (ZIMDbConnection *)connection {
+	if ((self = [super init])) {
+		_connection = connection;
+		_workload = [[NSCountedSet alloc] init];
+		_recommendations = [[NSMutableArray alloc] init];
+		_improvements = [[NSMutableDictionary alloc] init];
+	}
+	return self;
+}
+
+- (void) statement: (id)statement {
+	if ([statement conformsToProtocol: @protocol(ZIMSqlStatement)]) {
+		statement = [(id<ZIMSqlStatement>)statement statement];
+	}
+	if ([statement isKindOfClass: [NSString class]]) {
+		[_workload addObject: statement];
+	}
+}
+
+- (void) statements: (id<NSFastEnumeration>)statements {
+	for (id statement in statements) {
+		NSUInteger count = ([(NSObject *)statements isKindOfClass: [NSCountedSet class]]) ? [(NSCountedSet *)statements countForObject: statement] : 1;
+		for (NSUInteger i = 0; i < count; i++) {
+			[self statement: statement];
+		}
+	}
+}
+
+- (NSArray *) recommend {
+	[_recommendations removeAllObjects];
+	[_improvements removeAllObjects];
+
+	ZIMDbConnection *copy = [self copySchema];
+	NSMutableDictionary *tables = [[NSMutableDictionary alloc] init];
+	NSMutableDictionary *indexes = [[NSMutableDictionary alloc] init];
+
+	NSArray *workload = [[_workload allObjects] sortedArrayUsingSelector: @selector(compare:)];
+	for (NSString *sql in workload) {
+		NSString *command = [[NSString firstTokenInString: sql scanUpToCharactersFromSet: [NSCharacterSet characterSetWithCharactersInString: @" ;\"'`[]\n\r\t"]] uppercaseString];
+		if (!([command isEqualToString: @"SELECT"] || [command isEqualToString: @"UPDATE"] || [command isEqualToString: @"DELETE"] || [command isEqualToString: @"WITH"])) {
+			continue;
+		}
+		ZIMSqlTokenizer *tokenizer = [[ZIMSqlTokenizer alloc] initWithSqlStatement: sql];
+		ZIMDbQueryPlan *baseline;
+		@try {
+			baseline = [[ZIMDbQueryPlan alloc] initWithConnection: copy statement: tokenizer];
+		}
+		@catch (NSException *exception) {
+			continue; // e.g. the statement refers to a temporary table
+		}
+		NSMutableOrderedSet *scanned = [[NSMutableOrderedSet alloc] init];
+		NSMutableArray *stack = [[NSMutableArray alloc] initWithArray: [baseline nodes]];
+		while ([stack count] > 0) {
+			ZIMDbQueryPlanNode *node = [stack lastObject];
+			[stack removeLastObject];
+			[stack addObjectsFromArray: [node children]];
+			if ([node isLoop] && ([node table] != nil) && ![[[node table] lowercaseString] hasPrefix: @"sqlite_"]) {
+				[scanned addObject: [node table]];
+			}
+		}
+		for (NSString *table in scanned) {
+			NSDictionary *columns = [tables objectForKey: [table lowercaseString]];
+			if (columns == nil) {
+				columns = [self columnsOfTable: table connection: copy];
+				[tables setObject: columns forKey: [table lowercaseString]];
+			}
+			for (NSArray *candidate in [self candidatesForColumns: columns inStatement: tokenizer]) {
+				if ([self isCandidate: candidate coveredOnTable: table connection: copy]) {
+					continue;
+				}
+				ZIMSqlCreateIndexStatement *index = [self indexForCandidate: candidate onTable: table];
+				NSString *key = [index statement];
+				NSString *name = [NSString stringWithFormat: @"%@_zim_candidate", table];
+				ZIMSqlCreateIndexStatement *trial = [self indexForCandidate: candidate onTable: table];
+				[trial index: name on: table];
+				ZIMSqlDropIndexStatement *drop = [[ZIMSqlDropIndexStatement alloc] init];
+				[drop index: name exists: YES];
+				BOOL isUsed = NO;
+				@try {
+					[copy execute: [trial statement]];
+					ZIMDbQueryPlan *plan = [[ZIMDbQueryPlan alloc] initWithConnection: copy statement: tokenizer];
+					isUsed = [plan usesIndex: name];
+				}
+				@catch (NSException *exception) {
+					isUsed = NO;
+				}
+				@finally {
+					[copy execute: [drop statement]];
+				}
+				if (isUsed) {
+					NSMutableArray *improvements = [_improvements objectForKey: key];
+					if (improvements == nil) {
+						improvements = [[NSMutableArray alloc] init];
+						[_improvements setObject: improvements forKey: key];
+						[indexes setObject: index forKey: key];
+					}
+					[improvements addObject: sql];
+					break; // i.e. the candidates are ordered by preference
+				}
+			}
+		}
+	}
+
+	[copy close];
+
+	NSCountedSet *frequencies = _workload;
+	NSDictionary *improvements = _improvements;
+	[_recommendations addObjectsFromArray: [[indexes allValues] sortedArrayUsingComparator: ^NSComparisonResult (id obj1, id obj2) {
+		NSUInteger weight1 = 0;
+		for (NSString *sql in [improvements objectForKey: [obj1 statement]]) {
+			weight1 += [frequencies countForObject: sql];
+		}
+		NSUInteger weight2 = 0;
+		for (NSString *sql in [improvements objectForKey: [obj2 statement]]) {
+			weight2 += [frequencies countForObject: sql];
+		}
+		if (weight1 != weight2) {
+			return (weight1 > weight2) ? NSOrderedAscending : NSOrderedDescending;
+		}
+		return [[obj1 statement] compare: [obj2 statement]];
+	}]];
+
+	return _recommendations;
+}
+
+- (NSArray *) statementsImprovedBy: (ZIMSqlCreateIndexStatement *)index {
+	NSArray *improvements = [_improvements objectForKey: [index statement]];
+	return (improvements != nil) ? improvements : [NSArray array];
+}
+
+- (ZIMDbConnection *) copySchema {
+	ZIMDbConnection *copy = [[ZIMDbConnection alloc] initInMemory];
+	NSArray *schema = [_connection query: @"SELECT [type], [name], [sql] FROM [sqlite_master] WHERE [sql] IS NOT NULL AND [name] NOT LIKE 'sqlite_%' ORDER BY CASE [type] WHEN 'table' THEN 0 WHEN 'index' THEN 1 ELSE 2 END, [rowid];"];
+	for (NSDictionary *record in schema) {
+		@try {
+			[copy execute: [record objectForKey: @"sql"]];
+		}
+		@catch (NSException *exception) {
+			// e.g. a virtual table whose module has not been registered on this connection
+		}
+	}
+	// Note: Copying "sqlite_stat1" lets the planner weigh the candidates against the real distribution of data.
+	if ([[_connection query: @"SELECT 1 AS [found] FROM [sqlite_master] WHERE [type] = 'table' AND [name] = 'sqlite_stat1' LIMIT 1;"] count] > 0) {
+		[copy execute: @"ANALYZE [sqlite_master];"];
+		NSArray *statistics = [_connection query: @"SELECT [tbl], [idx], [stat] FROM [sqlite_stat1];"];
+		for (NSDictionary *record in statistics) {
+			NSArray *parameters = [NSArray arrayWithObjects: [record objectForKey: @"tbl"], ([record objectForKey: @"idx"] != nil) ? [record objectForKey: @"idx"] : [NSNull null], [record objectForKey: @"stat"], nil];
+			[copy execute: @"INSERT INTO [sqlite_stat1] ([tbl], [idx], [stat]) VALUES (?, ?, ?);" withParameters: parameters];
+		}
+		[copy execute: @"ANALYZE [sqlite_master];"];
+	}
+	return copy;
+}
+
+- (NSDictionary *) columnsOfTable: (NSString *)table connection: (ZIMDbConnection *)connection {
+	NSMutableDictionary *columns = [[NSMutableDictionary alloc] init];
+	NSArray *records = [connection query: [NSString stringWithFormat: @"PRAGMA table_info(%@);", [ZIMSqlExpression prepareIdentifier: table maxCount: 1]]];
+	for (NSDictionary *record in records) {
+		NSString *column = [record objectForKey: @"name"];
+		[columns setObject: column forKey: [column lowercaseString]];
+	}
+	return columns;
+}
+
+- (NSArray *) candidatesForColumns: (NSDictionary *)columns inStatement: (ZIMSqlTokenizer *)tokenizer {
+	NSMutableArray *tokens = [[NSMutableArray alloc] initWithCapacity: [tokenizer count]];
+	NSUInteger size = [tokenizer count];
+	for (NSUInteger i = 0; i < size; i++) {
+		if ([tokenizer tokenAtIndex: i].type != ZIMSqlTokenTypeWhitespace) {
+			[tokens addObject: [tokenizer objectAtIndex: i]];
+		}
+	}
+
+	NSMutableOrderedSet *equalities = [[NSMutableOrderedSet alloc] init];
+	NSMutableOrderedSet *ranges = [[NSMutableOrderedSet alloc] init];
+	NSMutableArray *orderings = [[NSMutableArray alloc] init];
+	NSMutableSet *ordered = [[NSMutableSet alloc] init];
+
+	NSSet *equalityOperators = [NSSet setWithObjects: @"=", @"==", @"IN", @"IS", nil];
+	NSSet *rangeOperators = [NSSet setWithObjects: @"<", @"<=", @">", @">=", @"BETWEEN", @"LIKE", @"GLOB", nil];
+	NSSet *boundaries = [NSSet setWithObjects: @"SELECT", @"FROM", @"SET", @"GROUP", @"HAVING", @"LIMIT", @"UNION", @"EXCEPT", @"INTERSECT", @"VALUES", @"JOIN", nil];
+
+	NSString *clause = nil;
+	NSUInteger count = [tokens count];
+	for (NSUInteger i = 0; i < count; i++) {
+		NSDictionary *tuple = [tokens objectAtIndex: i];
+		NSString *type = [tuple objectForKey: @"type"];
+		NSString *token = [tuple objectForKey: @"token"];
+		NSString *next = (i + 1 < count) ? [[[tokens objectAtIndex: i + 1] objectForKey: @"token"] uppercaseString] : nil;
+		if ([type isEqualToString: ZIMSqlTokenKeyword]) {
+			NSString *keyword = [token uppercaseString];
+			if ([keyword isEqualToString: @"WHERE"] || [keyword isEqualToString: @"ON"]) {
+				clause = @"WHERE";
+				continue;
+			}
+			if ([keyword isEqualToString: @"ORDER"] && [next isEqualToString: @"BY"]) {
+				clause = @"ORDER";
+				i++;
+				continue;
+			}
+			if ([boundaries containsObject: keyword]) {
+				clause = nil;
+				continue;
+			}
+		}
+		if ((clause == nil) || !([type isEqualToString: ZIMSqlTokenIdentifier] || [type isEqualToString: ZIMSqlTokenKeyword])) {
+			continue;
+		}
+		if ([next isEqualToString: @"."] || [next isEqualToString: @"("]) {
+			continue; // i.e. a qualifier or a function
+		}
+		if (([token length] > 1) && ([@"[\"`" rangeOfString: [token substringToIndex: 1]].location != NSNotFound)) {
+			token = [token substringWithRange: NSMakeRange(1, [token length] - 2)];
+		}
+		NSString *column = [columns objectForKey: [token lowercaseString]];
+		if (column == nil) {
+			continue;
+		}
+		if ([clause isEqualToString: @"ORDER"]) {
+			if (![ordered containsObject: column]) {
+				[ordered addObject: column];
+				[orderings addObject: [NSArray arrayWithObjects: column, [NSNumber numberWithBool: [next isEqualToString: @"DESC"]], nil]];
+			}
+			continue;
+		}
+		NSInteger before = (NSInteger)i - 1;
+		if ((before > 0) && [[[tokens objectAtIndex: before] objectForKey: @"token"] isEqualToString: @"."]) {
+			before -= 2; // i.e. skips the qualifier
+		}
+		NSString *previous = (before >= 0) ? [[[tokens objectAtIndex: before] objectForKey: @"token"] uppercaseString] : nil;
+		if ([equalityOperators containsObject: next] || [previous isEqualToString: @"="] || [previous isEqualToString: @"=="]) {
+			[equalities addObject: column];
+		}
+		else if ([rangeOperators containsObject: next] || [rangeOperators containsObject: previous]) {
+			[ranges addObject: column];
+		}
+	}
+
+	[ranges minusOrderedSet: equalities];
+
+	NSMutableArray *prefix = [[NSMutableArray alloc] init];
+	for (NSString *column in equalities) {
+		[prefix addObject: [NSArray arrayWithObjects: column, [NSNumber numberWithBool: NO], nil]];
+	}
+
+	NSMutableArray *candidates = [[NSMutableArray alloc] init];
+	if ([ranges count] > 0) {
+		NSMutableArray *candidate = [[NSMutableArray alloc] initWithArray: prefix];
+		[candidate addObject: [NSArray arrayWithObjects: [ranges objectAtIndex: 0], [NSNumber numberWithBool: NO], nil]];
+		[candidates addObject: candidate];
+	}
+	if ([orderings count] > 0) {
+		NSMutableArray *candidate = [[NSMutableArray alloc] initWithArray: prefix];
+		for (NSArray *ordering in orderings) {
+			if (![equalities containsObject: [ordering objectAtIndex: 0]]) {
+				[candidate addObject: ordering];
+			}
+		}
+		[candidates addObject: candidate];
+	}
+	if ([prefix count] > 0) {
+		[candidates addObject: prefix];
+	}
+
+	NSMutableArray *distinct = [[NSMutableArray alloc] initWithCapacity: [candidates count]];
+	for (NSArray *candidate in candidates) {
+		NSArray *columns = ([candidate count] > ZIMDbIndexAdvisorMaxColumns) ? [candidate subarrayWithRange: NSMakeRange(0, ZIMDbIndexAdvisorMaxColumns)] : candidate;
+		if (([columns count] > 0) && ![distinct containsObject: columns]) {
+			[distinct addObject: columns];
+		}
+	}
+	return distinct;
+}
+
+- (BOOL) isCandidate: (NSArray *)candidate coveredOnTable: (NSString *)table connection: (ZIMDbConnection *)connection {
+	NSArray *indexes = [connection query: [NSString stringWithFormat: @"PRAGMA index_list(%@);", [ZIMSqlExpression prepareIdentifier: table maxCount: 1]]];
+	for (NSDictionary *index in indexes) {
+		NSArray *columns = [connection query: [NSString stringWithFormat: @"PRAGMA index_info(%@);", [ZIMSqlExpression prepareIdentifier: [index objectForKey: @"name"] maxCount: 1]]];
+		if ([columns count] < [candidate count]) {
+			continue;
+		}
+		BOOL isCovered = YES;
+		NSUInteger i = 0;
+		for (NSArray *column in candidate) {
+			NSString *name = [[columns objectAtIndex: i] objectForKey: @"name"];
+			if (![name isKindOfClass: [NSString class]] || ([name caseInsensitiveCompare: [column objectAtIndex: 0]] != NSOrderedSame)) {
+				isCovered = NO;
+				break;
+			}
+			i++;
+		}
+		if (isCovered) {
+			return YES;
+		}
+	}
+	return NO;
+}
+
+- (ZIMSqlCreateIndexStatement *) indexForCandidate: (NSArray *)candidate onTable: (NSString *)table {
+	NSMutableString *name = [[NSMutableString alloc] initWithString: table];
+	ZIMSqlCreateIndexStatement *index = [[ZIMSqlCreateIndexStatement alloc] init];
+	for (NSArray *column in candidate) {
+		[name appendFormat: @"_%@", [column objectAtIndex: 0]];
+		[index column: [column objectAtIndex: 0] descending: [[column objectAtIndex: 1] boolValue]];
+	}
+	[name appendString: @"_idx"];
+	[index index: name on: table];
+	return index;
+}
+
+@end
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+
+@class ZIMDbConnection;
+
+#if !defined(ZIMDbMaintenanceOptimizeThreshold)
+#define ZIMDbMaintenanceOptimizeThreshold				1000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceAnalyzeThreshold)
+#define ZIMDbMaintenanceAnalyzeThreshold				10000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceAnalysisLimit)
+#define ZIMDbMaintenanceAnalysisLimit					400 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceCheckpointThreshold)
+#define ZIMDbMaintenanceCheckpointThreshold				1000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceTruncateThreshold)
+#define ZIMDbMaintenanceTruncateThreshold				10000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceVacuumRatio)
+#define ZIMDbMaintenanceVacuumRatio						0.2 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceVacuumPages)
+#define ZIMDbMaintenanceVacuumPages						256 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMDbMaintenanceSkipLimit)
+#define ZIMDbMaintenanceSkipLimit						10 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#define ZIMDbMaintenanceMetricRuns						@"runs"
+#define ZIMDbMaintenanceMetricSkips						@"skips"
+#define ZIMDbMaintenanceMetricOptimizations				@"optimizations"
+#define ZIMDbMaintenanceMetricAnalyses					@"analyses"
+#define ZIMDbMaintenanceMetricCheckpoints				@"checkpoints"
+#define ZIMDbMaintenanceMetricTruncations				@"truncations"
+#define ZIMDbMaintenanceMetricVacuums					@"vacuums"
+#define ZIMDbMaintenanceMetricFreelistRatio				@"freelistRatio"
+#define ZIMDbMaintenanceMetricFailures					@"failures"
+#define ZIMDbMaintenanceMetricPendingChanges			@"pendingChanges"
+#define ZIMDbMaintenanceMetricLogFrames					@"logFrames"
+#define ZIMDbMaintenanceMetricCheckpointedFrames		@"checkpointedFrames"
+#define ZIMDbMaintenanceMetricLastRun					@"lastRun"
+#define ZIMDbMaintenanceMetricLastDuration				@"lastDuration"
+#define ZIMDbMaintenanceMetricLastError					@"lastError"
+
+/*!
+ @class					ZIMDbMaintenanceScheduler
+ @discussion			This class keeps the query planner's statistics and the write-ahead log of a data
+						source in good order.  It counts the rows changed on the data source's pooled
+						connection and, when a threshold is crossed, runs "PRAGMA optimize", a targeted
+						"ANALYZE" (bounded by "PRAGMA analysis_limit"), and a passive (or, when the log
+						has grown large, a truncating) WAL checkpoint.  A database in "INCREMENTAL"
+						auto-vacuum mode also has its free pages reclaimed a few at a time.  Scheduled runs prefer an
+						idle window, i.e. a tick with no rows changed since the previous one, but are forced after
+						a limited number of busy ticks so that a steady write load does not postpone them forever.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_optimize
+ @see					http://www.sqlite.org/pragma.html#pragma_wal_checkpoint
+ */
+@interface ZIMDbMaintenanceScheduler : NSObject {
+
+	@protected
+		NSString *_dataSource;
+		NSMutableSet *_tables;
+		NSUInteger _optimizeThreshold;
+		NSUInteger _analyzeThreshold;
+		NSUInteger _analysisLimit;
+		NSUInteger _checkpointThreshold;
+		NSUInteger _truncateThreshold;
+		double _vacuumRatio;
+		NSUInteger _vacuumPages;
+		NSUInteger _skipLimit;
+		NSUInteger _skips;
+		NSInteger _totalChanges;
+		NSUInteger _changesSinceOptimize;
+		NSUInteger _changesSinceAnalyze;
+		NSUInteger _changesSinceCheckpoint;
+		NSMutableDictionary *_metrics;
+		dispatch_source_t _timer;
+
+}
+/*!
+ @method				initWithDataSource:
+ @discussion			This constructor creates an instance of this class for the specified data source.
+						Maintenance is run on the connection returned by ZIMDbConnectionPool.
+ @param dataSource		The file name of the database's PLIST to be used.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithDataSource: (NSString *)dataSource;
+/*!
+ @method				table:
+ @discussion			This method adds a table to be analyzed when the analyze threshold is crossed.  When
+						no tables are added, the whole database is analyzed.
+ @param table			The table to be analyzed.
+ @updated				2026-10-19
+ */
+- (void) table: (NSString *)table;
+/*!
+ @method				optimizeThreshold:
+ @discussion			This method sets the number of changed rows after which "PRAGMA optimize" is run
+						(0 disables the task).
+ @param threshold		The number of changed rows.
+ @updated				2026-10-19
+ */
+- (void) optimizeThreshold: (NSUInteger)threshold;
+/*!
+ @method				analyzeThreshold:analysisLimit:
+ @discussion			This method sets the number of changed rows after which "ANALYZE" is run (0 disables
+						the task) and the approximate number of rows examined in each index while analyzing (0 means that
+						every row is examined).
+ @param threshold		The number of changed rows.
+ @param limit			The analysis limit.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/pragma.html#pragma_analysis_limit
+ */
+- (void) analyzeThreshold: (NSUInteger)threshold analysisLimit: (NSUInteger)limit;
+/*!
+ @method				checkpointThreshold:truncateThreshold:
+ @discussion			This method sets the number of changed rows after which a passive WAL checkpoint is
+						run (0 disables the task) and the number of frames in the log at which the checkpoint is instead run in
+						truncate mode.
+ @param threshold		The number of changed rows.
+ @param frames			The number of frames in the log.
+ @updated				2026-10-19
+ */
+- (void) checkpointThreshold: (NSUInteger)threshold truncateThreshold: (NSUInteger)frames;
+/*!
+ @method				vacuumRatio:pages:
+ @discussion			This method sets the freelist ratio at which an incremental vacuum is run (0 disables
+						the task) and the maximum number of pages that each run frees.
+ @param ratio			The ratio of free pages to total pages.
+ @param pages			The maximum number of pages to be freed.
+ @updated				2026-10-19
+ */
+- (void) vacuumRatio: (double)ratio pages: (NSUInteger)pages;
+/*!
+ @method				skipLimit:
+ @discussion			This method sets the number of consecutive scheduled checks that may be skipped
+						because rows were changed before a check is made regardless.
+ @param limit			The maximum number of consecutive skips.
+ @updated				2026-10-19
+ */
+- (void) skipLimit: (NSUInteger)limit;
+/*!
+ @method				runIfNeeded
+ @discussion			This method will run only those maintenance tasks whose threshold has been crossed.
+ @return				Whether any maintenance task was run.
+ @updated				2026-10-19
+ */
+- (BOOL) runIfNeeded;
+/*!
+ @method				run
+ @discussion			This method will run every maintenance task regardless of its threshold.
+ @updated				2026-10-19
+ */
+- (void) run;
+/*!
+ @method				metrics
+ @discussion			This method returns a snapshot of the maintenance metrics (i.e. the number of runs,
+						skips, optimizations, analyses, checkpoints, vacuums, and failures, together with the state
+						of the log after the last checkpoint and the time taken by the last run).
+ @return				The maintenance metrics.
+ @updated				2026-10-19
+ */
+- (NSDictionary *) metrics;
+/*!
+ @method				schedule:
+ @discussion			This method will check the thresholds at the specified interval until unschedule
+						is called.  The checks are made on a private serial queue with their own connection,
+						and a run is skipped whenever rows were changed since the previous check, unless the
+						skip limit has been reached.
+ @param interval		The number of seconds between checks.
+ @updated				2026-10-19
+ */
+- (void) schedule: (NSTimeInterval)interval;
+/*!
+ @method				unschedule
+ @discussion			This method will stop the scheduled checks.
+ @updated				2026-10-19
+ */
+- (void) unschedule;
+
+@end
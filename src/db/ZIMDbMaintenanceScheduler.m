@@ -0,0 +1,333 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMDbConnection.h"
+#import "ZIMDbConnectionPool.h"
+#import "ZIMDbMaintenanceScheduler.h"
+#import "ZIMSqlAnalyzeStatement.h"
+
+/*!
+ @category				ZIMDbMaintenanceScheduler (Private)
+ @discussion			This category defines the prototpes for this class's private methods.
+ @updated				2026-10-19
+ */
+@interface ZIMDbMaintenanceScheduler (Private)
+/*!
+ @method				countChanges:
+ @discussion			This method will add the rows changed in the data source since the last count to
+						each task's pending changes.
+ @param connection		The connection to be used.
+ @return				The number of rows changed since the last count.
+ @updated				2026-10-19
+ */
+- (NSUInteger) countChanges: (ZIMDbConnection *)connection;
+/*!
+ @method				runIfNeededWithConnection:
+ @discussion			This method will run only those maintenance tasks whose threshold has been crossed.
+ @param connection		The connection to be used.
+ @return				Whether any maintenance task was run.
+ @updated				2026-10-19
+ */
+- (BOOL) runIfNeededWithConnection: (ZIMDbConnection *)connection;
+/*!
+ @method				runWithConnection:optimize:analyze:checkpoint:vacuum:
+ @discussion			This method will run the specified maintenance tasks and record their metrics.
+ @param connection		The connection to be used.
+ @param optimize		Whether "PRAGMA optimize" is to be run.
+ @param analyze			Whether "ANALYZE" is to be run.
+ @param checkpoint		Whether a WAL checkpoint is to be run.
+ @param vacuum			Whether an incremental vacuum is to be run.
+ @updated				2026-10-19
+ */
+- (void) runWithConnection: (ZIMDbConnection *)connection optimize: (BOOL)optimize analyze: (BOOL)analyze checkpoint: (BOOL)checkpoint vacuum: (BOOL)vacuum;
+/*!
+ @method				checkpoint:
+ @discussion			This method will run a passive WAL checkpoint, which is followed by a truncating
+						checkpoint when the log has grown past the truncate threshold.
+ @param connection		The connection to be used.
+ @updated				2026-10-19
+ */
+- (void) checkpoint: (ZIMDbConnection *)connection;
+/*!
+ @method				increment:
+ @discussion			This method will increment the specified metric.
+ @param metric			The metric to be incremented.
+ @updated				2026-10-19
+ */
+- (void) increment: (NSString *)metric;
+@end
+
+@implementation ZIMDbMaintenanceScheduler
+
+- (id) initWithDataSource: (NSString *)dataSource {
+	if ((self = [super init])) {
+		_dataSource = [dataSource copy];
+		_tables = [[NSMutableSet alloc] init];
+		_optimizeThreshold = ZIMDbMaintenanceOptimizeThreshold;
+		_analyzeThreshold = ZIMDbMaintenanceAnalyzeThreshold;
+		_analysisLimit = ZIMDbMaintenanceAnalysisLimit;
+		_checkpointThreshold = ZIMDbMaintenanceCheckpointThreshold;
+		_truncateThreshold = ZIMDbMaintenanceTruncateThreshold;
+		_vacuumRatio = ZIMDbMaintenanceVacuumRatio;
+		_vacuumPages = ZIMDbMaintenanceVacuumPages;
+		_skipLimit = ZIMDbMaintenanceSkipLimit;
+		_skips = 0;
+		_totalChanges = 0;
+		_changesSinceOptimize = 0;
+		_changesSinceAnalyze = 0;
+		_changesSinceCheckpoint = 0;
+		_metrics = [[NSMutableDictionary alloc] init];
+		_timer = nil;
+	}
+	return self;
+}
+
+- (void) table: (NSString *)table {
+	@synchronized(self) {
+		[_tables addObject: table];
+	}
+}
+
+- (void) optimizeThreshold: (NSUInteger)threshold {
+	_optimizeThreshold = threshold;
+}
+
+- (void) analyzeThreshold: (NSUInteger)threshold analysisLimit: (NSUInteger)limit {
+	_analyzeThreshold = threshold;
+	_analysisLimit = limit;
+}
+
+- (void) checkpointThreshold: (NSUInteger)threshold truncateThreshold: (NSUInteger)frames {
+	_checkpointThreshold = threshold;
+	_truncateThreshold = frames;
+}
+
+- (void) vacuumRatio: (double)ratio pages: (NSUInteger)pages {
+	_vacuumRatio = ratio;
+	_vacuumPages = pages;
+}
+
+- (void) skipLimit: (NSUInteger)limit {
+	_skipLimit = limit;
+}
+
+- (BOOL) runIfNeeded {
+	return [self runIfNeededWithConnection: [[ZIMDbConnectionPool sharedInstance] connection: _dataSource]];
+}
+
+- (BOOL) runIfNeededWithConnection: (ZIMDbConnection *)connection {
+	[self countChanges: connection];
+	BOOL optimize = ((_optimizeThreshold > 0) && (_changesSinceOptimize >= _optimizeThreshold));
+	BOOL analyze = ((_analyzeThreshold > 0) && (_changesSinceAnalyze >= _analyzeThreshold));
+	BOOL checkpoint = ((_checkpointThreshold > 0) && (_changesSinceCheckpoint >= _checkpointThreshold));
+	BOOL vacuum = ((_vacuumRatio > 0.0) && [connection needsIncrementalVacuum: _vacuumRatio]);
+	if (!optimize && !analyze && !checkpoint && !vacuum) {
+		return NO;
+	}
+	[self runWithConnection: connection optimize: (optimize && !analyze) analyze: analyze checkpoint: checkpoint vacuum: vacuum];
+	return YES;
+}
+
+- (void) run {
+	ZIMDbConnection *connection = [[ZIMDbConnectionPool sharedInstance] connection: _dataSource];
+	[self countChanges: connection];
+	[self runWithConnection: connection optimize: YES analyze: YES checkpoint: YES vacuum: [connection needsIncrementalVacuum: 0.0]];
+}
+
+- (NSDictionary *) metrics {
+	NSMutableDictionary *metrics = nil;
+	@synchronized(self) {
+		metrics = [_metrics mutableCopy];
+		[metrics setObject: [NSNumber numberWithUnsignedInteger: MAX(_changesSinceOptimize, MAX(_changesSinceAnalyze, _changesSinceCheckpoint))] forKey: ZIMDbMaintenanceMetricPendingChanges];
+	}
+	return metrics;
+}
+
+- (void) schedule: (NSTimeInterval)interval {
+	[self unschedule];
+	[self countChanges: [[ZIMDbConnectionPool sharedInstance] connection: _dataSource]]; // i.e. so that the first tick only sees the changes made after scheduling
+	_skips = 0;
+	dispatch_queue_t queue = dispatch_queue_create("com.ziminji.db.maintenance", DISPATCH_QUEUE_SERIAL);
+	_timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+#if !OS_OBJECT_USE_OBJC
+	dispatch_release(queue); // i.e. the timer retains its queue
+#endif
+	uint64_t nanoseconds = (uint64_t)(interval * NSEC_PER_SEC);
+	dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, nanoseconds), nanoseconds, nanoseconds / 10);
+	__weak ZIMDbMaintenanceScheduler *scheduler = self;
+	dispatch_source_set_event_handler(_timer, ^{
+		ZIMDbMaintenanceScheduler *this = scheduler;
+		if (this != nil) {
+			@try {
+				// Note: The pooled connection belongs to the main thread, so the checks use their own connection.
+				ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: this->_dataSource withMultithreadingSupport: NO];
+				if (([this countChanges: connection] > 0) && (this->_skips < this->_skipLimit)) { // i.e. the database is not idle
+					this->_skips++;
+					[this increment: ZIMDbMaintenanceMetricSkips];
+				}
+				else {
+					this->_skips = 0;
+					[this runIfNeededWithConnection: connection];
+				}
+			}
+			@catch (NSException *exception) {
+				// Note: A run that fails (e.g. because the database is busy) is retried at the next interval.
+			}
+		}
+	});
+	dispatch_resume(_timer);
+}
+
+- (void) unschedule {
+	if (_timer != nil) {
+		dispatch_source_cancel(_timer);
+#if !OS_OBJECT_USE_OBJC
+		dispatch_release(_timer); // i.e. dispatch objects are not managed by ARC before iOS 6
+#endif
+		_timer = nil;
+	}
+}
+
+- (void) dealloc {
+	[self unschedule];
+}
+
+- (NSUInteger) countChanges: (ZIMDbConnection *)connection {
+	NSInteger totalChanges = [connection totalChanges];
+	NSUInteger changes = 0;
+	@synchronized(self) {
+		// Note: The count is shared by every connection to the data source, so it never goes backwards.
+		changes = (totalChanges >= _totalChanges) ? (NSUInteger)(totalChanges - _totalChanges) : (NSUInteger)totalChanges;
+		_totalChanges = totalChanges;
+		_changesSinceOptimize += changes;
+		_changesSinceAnalyze += changes;
+		_changesSinceCheckpoint += changes;
+	}
+	return changes;
+}
+
+- (void) runWithConnection: (ZIMDbConnection *)connection optimize: (BOOL)optimize analyze: (BOOL)analyze checkpoint: (BOOL)checkpoint vacuum: (BOOL)vacuum {
+	NSDate *start = [NSDate date];
+	@try {
+		if (optimize || analyze) {
+			id previousLimit = nil;
+			if (ZIMSqlLibraryVersion() >= 3032000) {
+				NSArray *records = [connection query: @"PRAGMA analysis_limit;"];
+				if ([records count] > 0) {
+					previousLimit = [[[records objectAtIndex: 0] allValues] lastObject];
+				}
+				[connection execute: [NSString stringWithFormat: @"PRAGMA analysis_limit = %lu;", (unsigned long)_analysisLimit]];
+			}
+			@try {
+				if (analyze) {
+					NSArray *tables = nil;
+					@synchronized(self) {
+						tables = [_tables allObjects];
+					}
+					if ([tables count] > 0) {
+						for (NSString *table in tables) {
+							ZIMSqlAnalyzeStatement *statement = [[ZIMSqlAnalyzeStatement alloc] init];
+							[statement table: table];
+							[connection execute: [statement statement]];
+						}
+					}
+					else {
+						[connection execute: @"ANALYZE;"];
+					}
+					[self increment: ZIMDbMaintenanceMetricAnalyses];
+				}
+				else {
+					[connection execute: @"PRAGMA optimize;"];
+					[self increment: ZIMDbMaintenanceMetricOptimizations];
+				}
+			}
+			@finally {
+				if (previousLimit != nil) {
+					[connection execute: [NSString stringWithFormat: @"PRAGMA analysis_limit = %@;", previousLimit]];
+				}
+			}
+			@synchronized(self) {
+				// Note: Fresh statistics also satisfy "PRAGMA optimize".
+				_changesSinceOptimize = 0;
+				if (analyze) {
+					_changesSinceAnalyze = 0;
+				}
+			}
+		}
+		if (vacuum) {
+			[connection incrementalVacuum: _vacuumPages];
+			[self increment: ZIMDbMaintenanceMetricVacuums];
+			@synchronized(self) {
+				[_metrics setObject: [NSNumber numberWithDouble: [connection freelistRatio]] forKey: ZIMDbMaintenanceMetricFreelistRatio];
+			}
+		}
+		if (checkpoint) {
+			[self checkpoint: connection];
+		}
+		[self increment: ZIMDbMaintenanceMetricRuns];
+	}
+	@catch (NSException *exception) {
+		[self increment: ZIMDbMaintenanceMetricFailures];
+		@synchronized(self) {
+			[_metrics setObject: [exception reason] forKey: ZIMDbMaintenanceMetricLastError];
+		}
+		@throw exception;
+	}
+	@finally {
+		@synchronized(self) {
+			[_metrics setObject: start forKey: ZIMDbMaintenanceMetricLastRun];
+			[_metrics setObject: [NSNumber numberWithDouble: -[start timeIntervalSinceNow]] forKey: ZIMDbMaintenanceMetricLastDuration];
+		}
+	}
+}
+
+- (void) checkpoint: (ZIMDbConnection *)connection {
+	NSArray *records = [connection query: @"PRAGMA wal_checkpoint(PASSIVE);"];
+	if ([records count] == 0) {
+		return;
+	}
+	NSDictionary *record = [records objectAtIndex: 0];
+	NSInteger logFrames = [[record objectForKey: @"log"] integerValue];
+	if (logFrames < 0) { // i.e. the database is not in WAL mode
+		@synchronized(self) {
+			_changesSinceCheckpoint = 0;
+		}
+		return;
+	}
+	[self increment: ZIMDbMaintenanceMetricCheckpoints];
+	if ((_truncateThreshold > 0) && (logFrames >= (NSInteger)_truncateThreshold)) {
+		records = [connection query: @"PRAGMA wal_checkpoint(TRUNCATE);"];
+		if ([records count] > 0) {
+			record = [records objectAtIndex: 0];
+			if ([[record objectForKey: @"busy"] integerValue] == 0) {
+				[self increment: ZIMDbMaintenanceMetricTruncations];
+			}
+		}
+	}
+	@synchronized(self) {
+		_changesSinceCheckpoint = 0;
+		[_metrics setObject: [NSNumber numberWithInteger: [[record objectForKey: @"log"] integerValue]] forKey: ZIMDbMaintenanceMetricLogFrames];
+		[_metrics setObject: [NSNumber numberWithInteger: [[record objectForKey: @"checkpointed"] integerValue]] forKey: ZIMDbMaintenanceMetricCheckpointedFrames];
+	}
+}
+
+- (void) increment: (NSString *)metric {
+	@synchronized(self) {
+		NSUInteger count = [[_metrics objectForKey: metric] unsignedIntegerValue];
+		[_metrics setObject: [NSNumber numberWithUnsignedInteger: count + 1] forKey: metric];
+	}
+}
+
+@end
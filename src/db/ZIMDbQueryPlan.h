@@ -0,0 +1,99 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import "ZIMDbQueryPlanNode.h"
+#import "ZIMSqlStatement.h"
+
+@class ZIMDbConnection;
+
+/*!
+ @class					ZIMDbQueryPlan
+ @discussion			This class runs "EXPLAIN QUERY PLAN" for an SQL statement and parses the result into
+						a tree of classified steps.  It also reports the steps that are likely to be slow (e.g.
+						a full scan inside a loop), so that plan regressions can be caught by tests or logged
+						by a slow-query handler.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/eqp.html
+ */
+@interface ZIMDbQueryPlan : NSObject {
+
+	@protected
+		NSString *_statement;
+		NSMutableArray *_nodes;
+		NSMutableArray *_warnings;
+
+}
+/*!
+ @method				initWithConnection:statement:
+ @discussion			This constructor creates an instance of this class by explaining the specified
+						SQL statement with the specified connection.  The statement is not run.
+ @param connection		The connection to be used.
+ @param statement		The SQL statement to be explained.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithConnection: (ZIMDbConnection *)connection statement: (id<ZIMSqlStatement>)statement;
+/*!
+ @method				statement
+ @discussion			This method will return the SQL statement that was explained.
+ @return				The SQL statement that was explained.
+ @updated				2026-10-19
+ */
+- (NSString *) statement;
+/*!
+ @method				nodes
+ @discussion			This method will return the root nodes of the plan in the order that they are run.
+ @return				The root nodes of the plan.
+ @updated				2026-10-19
+ */
+- (NSArray *) nodes;
+/*!
+ @method				warnings
+ @discussion			This method will return a description of each step that is likely to be slow,
+						such as a full scan inside a loop, a temporary B-tree, an automatic index, or a
+						correlated subquery.
+ @return				The warnings (i.e. an empty array if none).
+ @updated				2026-10-19
+ */
+- (NSArray *) warnings;
+/*!
+ @method				usesIndex:
+ @discussion			This method checks whether any step of the plan reads through the specified index.
+ @param index			The name of the index.
+ @return				Indicates whether the index is used.
+ @updated				2026-10-19
+ */
+- (BOOL) usesIndex: (NSString *)index;
+/*!
+ @method				scansTable:
+ @discussion			This method checks whether any step of the plan reads every row of the specified
+						table without an index.
+ @param table			The name of the table.
+ @return				Indicates whether the table is fully scanned.
+ @updated				2026-10-19
+ */
+- (BOOL) scansTable: (NSString *)table;
+/*!
+ @method				dataSource:analyze:
+ @discussion			This method will explain the specified SQL statement with the specified data source.
+ @param dataSource		The file name of the database's PLIST to be used.
+ @param statement		The SQL statement to be explained.
+ @return				The query plan.
+ @updated				2026-10-19
+ */
++ (ZIMDbQueryPlan *) dataSource: (NSString *)dataSource analyze: (id<ZIMSqlStatement>)statement;
+
+@end
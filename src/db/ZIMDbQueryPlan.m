@@ -0,0 +1,163 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMDbConnection.h"
+#import "ZIMDbQueryPlan.h"
+#import "ZIMSqlExplainStatement.h"
+
+/*!
+ @category		ZIMDbQueryPlan (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMDbQueryPlan (Private)
+/*!
+ @method			buildTree:
+ @discussion		This method will link the explained rows into a tree of nodes.
+ @param records		The rows returned by "EXPLAIN QUERY PLAN".
+ @updated			2026-10-19
+ */
+- (void) buildTree: (NSArray *)records;
+/*!
+ @method			analyzeNodes:inLoop:
+ @discussion		This method will add a warning for each node that is likely to be slow.
+ @param nodes		The nodes to be analyzed.
+ @param inLoop		Whether the nodes are run once for every row of an outer loop.
+ @updated			2026-10-19
+ */
+- (void) analyzeNodes: (NSArray *)nodes inLoop: (BOOL)inLoop;
+/*!
+ @method			findNode:inNodes:
+ @discussion		This method will search the tree for a node that matches the specified predicate.
+ @param predicate	The predicate to be matched.
+ @param nodes		The nodes to be searched.
+ @return			Indicates whether a matching node was found.
+ @updated			2026-10-19
+ */
+- (BOOL) findNode: (BOOL (^)(ZIMDbQueryPlanNode *node))predicate inNodes: (NSArray *)nodes;
+@end
+
+@implementation ZIMDbQueryPlan
+
+- (id) initWithConnection: (ZIMDbConnection *)connection statement: (id<ZIMSqlStatement>)statement {
+	if ((self = [super init])) {
+		_statement = [statement statement];
+		_nodes = [[NSMutableArray alloc] init];
+		_warnings = [[NSMutableArray alloc] init];
+		ZIMSqlExplainStatement *explain = [[ZIMSqlExplainStatement alloc] init];
+		[explain level: ZIMSqlExplainHighLevelInformation];
+		[explain sql: statement];
+		[self buildTree: [connection query: [explain statement]]];
+		[self analyzeNodes: _nodes inLoop: NO];
+	}
+	return self;
+}
+
+- (NSString *) statement {
+	return _statement;
+}
+
+- (NSArray *) nodes {
+	return _nodes;
+}
+
+- (NSArray *) warnings {
+	return _warnings;
+}
+
+- (BOOL) usesIndex: (NSString *)index {
+	return [self findNode: ^BOOL (ZIMDbQueryPlanNode *node) {
+		return (([node index] != nil) && ([[node index] caseInsensitiveCompare: index] == NSOrderedSame));
+	} inNodes: _nodes];
+}
+
+- (BOOL) scansTable: (NSString *)table {
+	return [self findNode: ^BOOL (ZIMDbQueryPlanNode *node) {
+		return ([node isFullScan] && ([[node table] caseInsensitiveCompare: table] == NSOrderedSame));
+	} inNodes: _nodes];
+}
+
+- (NSString *) description {
+	NSMutableString *description = [[NSMutableString alloc] initWithString: @"QUERY PLAN"];
+	for (ZIMDbQueryPlanNode *node in _nodes) {
+		NSString *lines = [[node description] stringByReplacingOccurrencesOfString: @"\n" withString: @"\n   "];
+		[description appendFormat: @"\n|--%@", lines];
+	}
+	return description;
+}
+
+- (void) buildTree: (NSArray *)records {
+	// Note: Prior to SQLite 3.24.0, the rows had no "id" and "parent" columns and so are treated as a flat list.
+	NSMutableDictionary *nodes = [[NSMutableDictionary alloc] initWithCapacity: [records count]];
+	NSInteger i = 0;
+	for (NSDictionary *record in records) {
+		i++;
+		id identifier = [record objectForKey: @"id"];
+		id parent = [record objectForKey: @"parent"];
+		ZIMDbQueryPlanNode *node = [[ZIMDbQueryPlanNode alloc] initWithIdentifier: (identifier != nil) ? [identifier integerValue] : i parent: (parent != nil) ? [parent integerValue] : 0 detail: [record objectForKey: @"detail"]];
+		ZIMDbQueryPlanNode *owner = [nodes objectForKey: [NSNumber numberWithInteger: [node parent]]];
+		if (owner != nil) {
+			[owner addChild: node];
+		}
+		else {
+			[_nodes addObject: node];
+		}
+		[nodes setObject: node forKey: [NSNumber numberWithInteger: [node identifier]]];
+	}
+}
+
+- (void) analyzeNodes: (NSArray *)nodes inLoop: (BOOL)inLoop {
+	// Note: Sibling loops are nested (i.e. each loop after the first is run once for every row of the loops
+	// before it), and a correlated subquery is run once for every row of the outer query.
+	BOOL isNested = inLoop;
+	for (ZIMDbQueryPlanNode *node in nodes) {
+		if ([node isFullScan]) {
+			[_warnings addObject: (isNested)
+				? [NSString stringWithFormat: @"Full scan of `%@` inside a loop.", [node table]]
+				: [NSString stringWithFormat: @"Full scan of `%@`.", [node table]]];
+		}
+		if ([node isAutomaticIndex]) {
+			[_warnings addObject: [NSString stringWithFormat: @"Automatic index built on `%@`; consider declaring an index.", [node table]]];
+		}
+		if ([node purpose] != nil) {
+			[_warnings addObject: [NSString stringWithFormat: @"Temporary B-tree built for %@.", [node purpose]]];
+		}
+		if ([node isCorrelated]) {
+			[_warnings addObject: @"Correlated subquery is run for every row of the outer query."];
+		}
+		[self analyzeNodes: [node children] inLoop: (isNested || [node isCorrelated])];
+		if ([node isLoop]) {
+			isNested = YES;
+		}
+	}
+}
+
+- (BOOL) findNode: (BOOL (^)(ZIMDbQueryPlanNode *node))predicate inNodes: (NSArray *)nodes {
+	for (ZIMDbQueryPlanNode *node in nodes) {
+		if (predicate(node) || [self findNode: predicate inNodes: [node children]]) {
+			return YES;
+		}
+	}
+	return NO;
+}
+
++ (ZIMDbQueryPlan *) dataSource: (NSString *)dataSource analyze: (id<ZIMSqlStatement>)statement {
+	ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: dataSource withMultithreadingSupport: NO];
+	ZIMDbQueryPlan *plan = [[ZIMDbQueryPlan alloc] initWithConnection: connection statement: statement];
+	[connection close];
+	return plan;
+}
+
+@end
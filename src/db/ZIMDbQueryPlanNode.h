@@ -0,0 +1,165 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+
+// Node Types -- http://www.sqlite.org/eqp.html
+#define ZIMDbQueryPlanNodeTypeScan					@"SCAN"
+#define ZIMDbQueryPlanNodeTypeSearch				@"SEARCH"
+#define ZIMDbQueryPlanNodeTypeTemporaryBTree		@"TEMP B-TREE"
+#define ZIMDbQueryPlanNodeTypeSubquery				@"SUBQUERY"
+#define ZIMDbQueryPlanNodeTypeCompound				@"COMPOUND"
+#define ZIMDbQueryPlanNodeTypeOther					@"OTHER"
+
+/*!
+ @class					ZIMDbQueryPlanNode
+ @discussion			This class represents a single step of a query plan (i.e. one row returned by
+						"EXPLAIN QUERY PLAN"), which is classified when it is parsed.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/eqp.html
+ */
+@interface ZIMDbQueryPlanNode : NSObject {
+
+	@protected
+		NSInteger _identifier;
+		NSInteger _parent;
+		NSString *_detail;
+		NSString *_type;
+		NSString *_table;
+		NSString *_index;
+		NSString *_purpose;
+		BOOL _isFullScan;
+		BOOL _isCoveringIndex;
+		BOOL _isAutomaticIndex;
+		BOOL _isCorrelated;
+		NSMutableArray *_children;
+
+}
+/*!
+ @method				initWithIdentifier:parent:detail:
+ @discussion			This constructor creates an instance of this class by parsing the specified detail.
+ @param identifier		The node's id.
+ @param parent			The id of the node's parent or 0 if it is a root.
+ @param detail			The text that describes the step.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithIdentifier: (NSInteger)identifier parent: (NSInteger)parent detail: (NSString *)detail;
+/*!
+ @method				identifier
+ @discussion			This method will return the node's id.
+ @return				The node's id.
+ @updated				2026-10-19
+ */
+- (NSInteger) identifier;
+/*!
+ @method				parent
+ @discussion			This method will return the id of the node's parent.
+ @return				The id of the node's parent or 0 if it is a root.
+ @updated				2026-10-19
+ */
+- (NSInteger) parent;
+/*!
+ @method				detail
+ @discussion			This method will return the text that describes the step.
+ @return				The text that describes the step.
+ @updated				2026-10-19
+ */
+- (NSString *) detail;
+/*!
+ @method				type
+ @discussion			This method will return the type of step (e.g. ZIMDbQueryPlanNodeTypeScan).
+ @return				The type of step.
+ @updated				2026-10-19
+ */
+- (NSString *) type;
+/*!
+ @method				table
+ @discussion			This method will return the table that is scanned or searched.
+ @return				The table or nil if the step does not read a table.
+ @updated				2026-10-19
+ */
+- (NSString *) table;
+/*!
+ @method				index
+ @discussion			This method will return the index that is used to read the table.
+ @return				The index or nil if no named index is used.
+ @updated				2026-10-19
+ */
+- (NSString *) index;
+/*!
+ @method				purpose
+ @discussion			This method will return the clause for which a temporary B-tree is built (e.g.
+						"ORDER BY", "GROUP BY", or "DISTINCT").
+ @return				The clause or nil if the step does not build a temporary B-tree.
+ @updated				2026-10-19
+ */
+- (NSString *) purpose;
+/*!
+ @method				isLoop
+ @discussion			This method checks whether the step loops over the rows of a table (i.e. it is
+						either a scan or a search).
+ @return				Indicates whether the step is a loop.
+ @updated				2026-10-19
+ */
+- (BOOL) isLoop;
+/*!
+ @method				isFullScan
+ @discussion			This method checks whether the step reads every row of a table without an index.
+ @return				Indicates whether the step is a full scan.
+ @updated				2026-10-19
+ */
+- (BOOL) isFullScan;
+/*!
+ @method				isCoveringIndex
+ @discussion			This method checks whether the step reads only from an index (i.e. the table
+						itself is never read).
+ @return				Indicates whether a covering index is used.
+ @updated				2026-10-19
+ */
+- (BOOL) isCoveringIndex;
+/*!
+ @method				isAutomaticIndex
+ @discussion			This method checks whether SQLite builds a transient index for the step, which
+						usually means that a persistent index is missing.
+ @return				Indicates whether an automatic index is built.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/optoverview.html#autoindex
+ */
+- (BOOL) isAutomaticIndex;
+/*!
+ @method				isCorrelated
+ @discussion			This method checks whether the step is a correlated subquery, which is run again
+						for every row of the outer query.
+ @return				Indicates whether the step is a correlated subquery.
+ @updated				2026-10-19
+ */
+- (BOOL) isCorrelated;
+/*!
+ @method				children
+ @discussion			This method will return the node's children in the order that they are run.
+ @return				The node's children.
+ @updated				2026-10-19
+ */
+- (NSArray *) children;
+/*!
+ @method				addChild:
+ @discussion			This method will add a child to the node.
+ @param child			The child to be added.
+ @updated				2026-10-19
+ */
+- (void) addChild: (ZIMDbQueryPlanNode *)child;
+
+@end
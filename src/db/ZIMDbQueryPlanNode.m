@@ -0,0 +1,182 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMDbQueryPlanNode.h"
+
+/*!
+ @category		ZIMDbQueryPlanNode (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMDbQueryPlanNode (Private)
+/*!
+ @method			parseDetail
+ @discussion		This method will classify the step by parsing its detail.
+ @updated			2026-10-19
+ */
+- (void) parseDetail;
+/*!
+ @method			tokenAfter:
+ @discussion		This method will return the token that follows the specified text in the detail.
+ @param text		The text to be searched for.
+ @return			The token or nil if the text could not be found.
+ @updated			2026-10-19
+ */
+- (NSString *) tokenAfter: (NSString *)text;
+@end
+
+@implementation ZIMDbQueryPlanNode
+
+- (id) initWithIdentifier: (NSInteger)identifier parent: (NSInteger)parent detail: (NSString *)detail {
+	if ((self = [super init])) {
+		_identifier = identifier;
+		_parent = parent;
+		_detail = (detail != nil) ? detail : @"";
+		_type = ZIMDbQueryPlanNodeTypeOther;
+		_table = nil;
+		_index = nil;
+		_purpose = nil;
+		_isFullScan = NO;
+		_isCoveringIndex = NO;
+		_isAutomaticIndex = NO;
+		_isCorrelated = NO;
+		_children = [[NSMutableArray alloc] init];
+		[self parseDetail];
+	}
+	return self;
+}
+
+- (NSInteger) identifier {
+	return _identifier;
+}
+
+- (NSInteger) parent {
+	return _parent;
+}
+
+- (NSString *) detail {
+	return _detail;
+}
+
+- (NSString *) type {
+	return _type;
+}
+
+- (NSString *) table {
+	return _table;
+}
+
+- (NSString *) index {
+	return _index;
+}
+
+- (NSString *) purpose {
+	return _purpose;
+}
+
+- (BOOL) isLoop {
+	return ([_type isEqualToString: ZIMDbQueryPlanNodeTypeScan] || [_type isEqualToString: ZIMDbQueryPlanNodeTypeSearch]);
+}
+
+- (BOOL) isFullScan {
+	return _isFullScan;
+}
+
+- (BOOL) isCoveringIndex {
+	return _isCoveringIndex;
+}
+
+- (BOOL) isAutomaticIndex {
+	return _isAutomaticIndex;
+}
+
+- (BOOL) isCorrelated {
+	return _isCorrelated;
+}
+
+- (NSArray *) children {
+	return _children;
+}
+
+- (void) addChild: (ZIMDbQueryPlanNode *)child {
+	[_children addObject: child];
+}
+
+- (NSString *) description {
+	NSMutableString *description = [[NSMutableString alloc] initWithString: _detail];
+	for (ZIMDbQueryPlanNode *child in _children) {
+		NSString *lines = [[child description] stringByReplacingOccurrencesOfString: @"\n" withString: @"\n   "];
+		[description appendFormat: @"\n|--%@", lines];
+	}
+	return description;
+}
+
+- (void) parseDetail {
+	// Note: The wording changed in SQLite 3.36.0 (e.g. "SCAN TABLE t" became "SCAN t"), so both forms are parsed.
+	NSString *detail = [_detail uppercaseString];
+	if ([detail hasPrefix: @"SCAN "] || [detail hasPrefix: @"SEARCH "]) {
+		BOOL isScan = [detail hasPrefix: @"SCAN "];
+		_type = (isScan) ? ZIMDbQueryPlanNodeTypeScan : ZIMDbQueryPlanNodeTypeSearch;
+		NSString *table = [self tokenAfter: (isScan) ? @"SCAN " : @"SEARCH "];
+		if ([[table uppercaseString] isEqualToString: @"TABLE"] || [[table uppercaseString] isEqualToString: @"SUBQUERY"]) {
+			table = [self tokenAfter: [NSString stringWithFormat: @"%@ ", table]];
+		}
+		if ([[table uppercaseString] isEqualToString: @"CONSTANT"]) { // i.e. "SCAN CONSTANT ROW"
+			_type = ZIMDbQueryPlanNodeTypeOther;
+			return;
+		}
+		_table = table;
+		_isAutomaticIndex = ([detail rangeOfString: @" AUTOMATIC "].location != NSNotFound);
+		_isCoveringIndex = ([detail rangeOfString: @" COVERING INDEX"].location != NSNotFound);
+		if (!_isAutomaticIndex) {
+			_index = [self tokenAfter: (_isCoveringIndex) ? @"USING COVERING INDEX " : @"USING INDEX "];
+		}
+		_isFullScan = (isScan && ([detail rangeOfString: @" USING "].location == NSNotFound) && ([detail rangeOfString: @" VIRTUAL TABLE "].location == NSNotFound));
+	}
+	else if ([detail hasPrefix: @"USE TEMP B-TREE FOR "]) {
+		_type = ZIMDbQueryPlanNodeTypeTemporaryBTree;
+		_purpose = [_detail substringFromIndex: 20];
+	}
+	else if ([detail hasPrefix: @"CREATE AUTOMATIC INDEX ON "]) { // i.e. prior to SQLite 3.24.0
+		_isAutomaticIndex = YES;
+		_table = [[[self tokenAfter: @"INDEX ON "] componentsSeparatedByString: @"("] objectAtIndex: 0];
+	}
+	else if ([detail hasPrefix: @"CORRELATED "]) {
+		_type = ZIMDbQueryPlanNodeTypeSubquery;
+		_isCorrelated = YES;
+	}
+	else if ([detail hasPrefix: @"EXECUTE CORRELATED "]) { // i.e. prior to SQLite 3.24.0
+		_type = ZIMDbQueryPlanNodeTypeSubquery;
+		_isCorrelated = YES;
+	}
+	else if ([detail hasPrefix: @"SCALAR SUBQUERY"] || [detail hasPrefix: @"LIST SUBQUERY"] || [detail hasPrefix: @"EXECUTE "] || [detail hasPrefix: @"MATERIALIZE"] || [detail hasPrefix: @"CO-ROUTINE"]) {
+		_type = ZIMDbQueryPlanNodeTypeSubquery;
+	}
+	else if ([detail hasPrefix: @"COMPOUND"] || [detail hasPrefix: @"LEFT-MOST SUBQUERY"] || [detail hasPrefix: @"UNION "] || [detail hasPrefix: @"INTERSECT "] || [detail hasPrefix: @"EXCEPT "]) {
+		_type = ZIMDbQueryPlanNodeTypeCompound;
+	}
+}
+
+- (NSString *) tokenAfter: (NSString *)text {
+	NSRange range = [_detail rangeOfString: text options: NSCaseInsensitiveSearch];
+	if (range.location == NSNotFound) {
+		return nil;
+	}
+	NSString *remainder = [_detail substringFromIndex: NSMaxRange(range)];
+	NSRange end = [remainder rangeOfCharacterFromSet: [NSCharacterSet whitespaceCharacterSet]];
+	return (end.location != NSNotFound) ? [remainder substringToIndex: end.location] : remainder;
+}
+
+@end
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import "ZIMDbBatchExecutor.h"
+#import "ZIMSqlDeleteStatement.h"
+
+/*!
+ @class					ZIMDbRetentionPolicy
+ @discussion			This class defines how long the rows of a table are kept.  The rows whose timestamp
+						is older than the time-to-live are purged in batches by ZIMDbBatchExecutor, either on
+						demand or on a schedule.
+ @updated				2026-10-19
+ */
+@interface ZIMDbRetentionPolicy : NSObject {
+
+	@protected
+		NSString *_table;
+		NSString *_column;
+		NSTimeInterval _timeToLive;
+		NSString *_key;
+		BOOL _unixTime;
+		NSUInteger _batchSize;
+		NSTimeInterval _pause;
+		dispatch_source_t _timer;
+
+}
+/*!
+ @method				initWithTable:column:timeToLive:
+ @discussion			This constructor creates an instance of this class with the specified policy.
+ @param table			The table to be purged.
+ @param column			The column that stores when each row was written.
+ @param timeToLive		The number of seconds that a row is kept.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithTable: (NSString *)table column: (NSString *)column timeToLive: (NSTimeInterval)timeToLive;
+/*!
+ @method				key:
+ @discussion			This method sets the unique column by which the rows are batched.  The default
+						is "rowid"; a table without a rowid must use its primary key.
+ @param key				The column by which the rows are batched.
+ @updated				2026-10-19
+ */
+- (void) key: (NSString *)key;
+/*!
+ @method				unixTime:
+ @discussion			This method establishes whether the timestamp column stores the number of seconds
+						since 1970-01-01 rather than a date.  Otherwise, the column must hold dates as
+						written by the connection (i.e. when an NSDate is bound), against which the cutoff
+						is bound in the same way.
+ @param unixTime		Establishes whether the column stores Unix time.
+ @updated				2026-10-19
+ */
+- (void) unixTime: (BOOL)unixTime;
+/*!
+ @method				batchSize:
+ @discussion			This method sets the maximum number of rows that are deleted by each batch.
+ @param size			The maximum number of rows in each batch.
+ @updated				2026-10-19
+ */
+- (void) batchSize: (NSUInteger)size;
+/*!
+ @method				pause:
+ @discussion			This method sets how long the purge will wait between batches.
+ @param pause			The number of seconds to wait.
+ @updated				2026-10-19
+ */
+- (void) pause: (NSTimeInterval)pause;
+/*!
+ @method				statement
+ @discussion			This method will create the delete statement for the rows that have expired as
+						of now.
+ @return				The delete statement.
+ @updated				2026-10-19
+ */
+- (ZIMSqlDeleteStatement *) statement;
+/*!
+ @method				executorWithConnection:
+ @discussion			This method will create an executor that purges the rows that have expired as
+						of now.
+ @param connection		The connection to be used.
+ @return				The executor.
+ @updated				2026-10-19
+ */
+- (ZIMDbBatchExecutor *) executorWithConnection: (ZIMDbConnection *)connection;
+/*!
+ @method				purge:
+ @discussion			This method will purge, in batches, the rows that have expired.
+ @param connection		The connection to be used.
+ @return				The number of rows that were purged.
+ @updated				2026-10-19
+ */
+- (NSUInteger) purge: (ZIMDbConnection *)connection;
+/*!
+ @method				schedule:interval:
+ @discussion			This method will purge the expired rows of the specified data source on a
+						background queue at the specified interval, until unschedule is called.
+ @param dataSource		The file name of the database's PLIST to be used.
+ @param interval		The number of seconds between purges, which must be greater than zero.
+ @updated				2026-10-19
+ */
+- (void) schedule: (NSString *)dataSource interval: (NSTimeInterval)interval;
+/*!
+ @method				unschedule
+ @discussion			This method will stop the scheduled purges.
+ @updated				2026-10-19
+ */
+- (void) unschedule;
+
+@end
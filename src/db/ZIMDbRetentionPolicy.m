@@ -0,0 +1,125 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMDbConnection.h"
+#import "ZIMDbRetentionPolicy.h"
+
+@implementation ZIMDbRetentionPolicy
+
+- (id) initWithTable: (NSString *)table column: (NSString *)column timeToLive: (NSTimeInterval)timeToLive {
+	if ((self = [super init])) {
+		_table = [table copy];
+		_column = [column copy];
+		_timeToLive = timeToLive;
+		_key = @"rowid";
+		_unixTime = NO;
+		_batchSize = 0;
+		_pause = -1.0;
+		_timer = nil;
+	}
+	return self;
+}
+
+- (void) key: (NSString *)key {
+	_key = [key copy];
+}
+
+- (void) unixTime: (BOOL)unixTime {
+	_unixTime = unixTime;
+}
+
+- (void) batchSize: (NSUInteger)size {
+	_batchSize = size;
+}
+
+- (void) pause: (NSTimeInterval)pause {
+	_pause = pause;
+}
+
+- (ZIMSqlDeleteStatement *) statement {
+	NSDate *cutoff = [NSDate dateWithTimeIntervalSinceNow: -_timeToLive];
+	ZIMSqlDeleteStatement *delete = [[ZIMSqlDeleteStatement alloc] init];
+	[delete table: _table];
+	if (_unixTime) {
+		[delete where: _column operator: ZIMSqlOperatorLessThan value: [NSNumber numberWithLongLong: (long long)[cutoff timeIntervalSince1970]]];
+	}
+	else {
+		// Note: The cutoff stays an NSDate so that the connection binds it with the same date formatter it uses to
+		// write and read date columns; it is never rendered into the statement as a string.
+		[delete where: _column operator: ZIMSqlOperatorLessThan value: cutoff];
+	}
+	return delete;
+}
+
+- (ZIMDbBatchExecutor *) executorWithConnection: (ZIMDbConnection *)connection {
+	ZIMDbBatchExecutor *executor = [[ZIMDbBatchExecutor alloc] initWithConnection: connection statement: [self statement] key: _key];
+	if (_batchSize > 0) {
+		[executor batchSize: _batchSize];
+	}
+	if (_pause >= 0.0) {
+		[executor pause: _pause];
+	}
+	return executor;
+}
+
+- (NSUInteger) purge: (ZIMDbConnection *)connection {
+	ZIMDbBatchExecutor *executor = [self executorWithConnection: connection];
+	[executor execute];
+	return [executor changes];
+}
+
+- (void) schedule: (NSString *)dataSource interval: (NSTimeInterval)interval {
+	if (!(interval > 0.0)) { // i.e. a zero interval would purge continuously
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: @"Interval must be greater than zero." userInfo: nil];
+	}
+	[self unschedule];
+	dispatch_queue_t queue = dispatch_queue_create("com.ziminji.db.retention", DISPATCH_QUEUE_SERIAL);
+	_timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+#if !OS_OBJECT_USE_OBJC
+	dispatch_release(queue); // i.e. the timer retains its queue
+#endif
+	uint64_t nanoseconds = (uint64_t)(interval * NSEC_PER_SEC);
+	dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, nanoseconds), nanoseconds, nanoseconds / 10);
+	__weak ZIMDbRetentionPolicy *policy = self;
+	dispatch_source_set_event_handler(_timer, ^{
+		ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: dataSource withMultithreadingSupport: NO];
+		@try {
+			[policy purge: connection];
+		}
+		@catch (NSException *exception) {
+			// Note: A purge that fails (e.g. because the database is busy) is retried at the next interval.
+		}
+		@finally {
+			[connection close];
+		}
+	});
+	dispatch_resume(_timer);
+}
+
+- (void) unschedule {
+	if (_timer != nil) {
+		dispatch_source_cancel(_timer);
+#if !OS_OBJECT_USE_OBJC
+		dispatch_release(_timer); // i.e. dispatch objects are not managed by ARC before iOS 6
+#endif
+		_timer = nil;
+	}
+}
+
+- (void) dealloc {
+	[self unschedule];
+}
+
+@end
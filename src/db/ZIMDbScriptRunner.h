@@ -0,0 +1,123 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import "ZIMDbScriptRunnerDelegate.h"
+
+@class ZIMDbConnection;
+@class ZIMSqlStatementSplitter;
+
+/*!
+ @class					ZIMDbScriptRunner
+ @discussion			This class runs an SQL script (e.g. a migration or a seed script) one statement at
+						a time, committing the statements in batches and reporting its progress, so that
+						neither the script nor its changes need to be held in memory all at once.  A script
+						that begins and ends its own transactions is run as written, and statements that cannot
+						run (or take effect) inside of a transaction, such as ATTACH, DETACH, PRAGMA, and VACUUM,
+						end the open batch and are run on their own.
+ @updated				2026-10-19
+ */
+@interface ZIMDbScriptRunner : NSObject {
+
+	@protected
+		id __unsafe_unretained _delegate;
+		ZIMDbConnection *_connection;
+		ZIMSqlStatementSplitter *_splitter;
+		NSUInteger _batchSize;
+		NSUInteger _statements;
+		NSUInteger _batches;
+		BOOL _isFinished;
+		atomic_bool _isCancelled;
+
+}
+
+@property (nonatomic, unsafe_unretained) id delegate;
+
+/*!
+ @method				initWithConnection:
+ @discussion			This constructor creates an instance of this class that will run scripts on the
+						specified connection.
+ @param connection		The connection to be used.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithConnection: (ZIMDbConnection *)connection;
+/*!
+ @method				batchSize:
+ @discussion			This method sets the maximum number of statements that are committed by each
+						transaction (0 means that each statement is committed on its own, and the
+						delegate is notified after each statement).
+ @param size			The maximum number of statements in each batch.
+ @updated				2026-10-19
+ */
+- (void) batchSize: (NSUInteger)size;
+/*!
+ @method				statements
+ @discussion			This method will return the number of statements that have been committed.
+ @return				The number of statements that have been committed.
+ @updated				2026-10-19
+ */
+- (NSUInteger) statements;
+/*!
+ @method				batches
+ @discussion			This method will return the number of batches that have been committed.
+ @return				The number of batches that have been committed.
+ @updated				2026-10-19
+ */
+- (NSUInteger) batches;
+/*!
+ @method				progress
+ @discussion			This method will return the fraction of the script that has been run.
+ @return				A value between 0.0 and 1.0 (i.e. 0.0 when the script's size is not known).
+ @updated				2026-10-19
+ */
+- (double) progress;
+/*!
+ @method				isFinished
+ @discussion			This method checks whether every statement in the script has been run.
+ @return				Indicates whether the runner has finished.
+ @updated				2026-10-19
+ */
+- (BOOL) isFinished;
+/*!
+ @method				run:
+ @discussion			This method will run the statements returned by the specified splitter until the
+						script ends, the runner is cancelled, or the delegate asks it to stop.  It blocks,
+						so it should be called on a background queue.  If a statement fails, the runner's open
+						batch is rolled back and an exception is thrown; the batches already committed are kept,
+						and a transaction begun by the script itself is left open for the caller to resolve.
+ @param splitter		The splitter that reads the script.
+ @return				Indicates whether the runner has finished.
+ @updated				2026-10-19
+ */
+- (BOOL) run: (ZIMSqlStatementSplitter *)splitter;
+/*!
+ @method				runFile:
+ @discussion			This method will run the script in the specified file.
+ @param path			The path to the script.
+ @return				Indicates whether the runner has finished.
+ @updated				2026-10-19
+ */
+- (BOOL) runFile: (NSString *)path;
+/*!
+ @method				cancel
+ @discussion			This method will stop the runner once the current batch has been committed.  It may
+						be called from any thread.
+ @updated				2026-10-19
+ */
+- (void) cancel;
+
+@end
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "NSString+ZIMString.h"
+#import "ZIMDbConnection.h"
+#import "ZIMDbScriptRunner.h"
+#import "ZIMSqlStatementSplitter.h"
+
+/*!
+ @category				ZIMDbScriptRunner (Private)
+ @discussion			This category defines the prototpes for this class's private methods.
+ @updated				2026-10-19
+ */
+@interface ZIMDbScriptRunner (Private)
+/*!
+ @method				didFinishBatch
+ @discussion			This method will notify the delegate that a batch (or a statement that was run
+						outside of a batch) has been committed.
+ @return				Whether the runner should continue.
+ @updated				2026-10-19
+ */
+- (BOOL) didFinishBatch;
+@end
+
+@implementation ZIMDbScriptRunner
+
+#if !defined(ZIMDbScriptRunnerBatchSize)
+    #define ZIMDbScriptRunnerBatchSize 1000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+@synthesize delegate = _delegate;
+
+- (id) initWithConnection: (ZIMDbConnection *)connection {
+	if ((self = [super init])) {
+		_delegate = nil;
+		_connection = connection;
+		_splitter = nil;
+		_batchSize = ZIMDbScriptRunnerBatchSize;
+		_statements = 0;
+		_batches = 0;
+		_isFinished = NO;
+		atomic_init(&_isCancelled, NO);
+	}
+	return self;
+}
+
+- (void) batchSize: (NSUInteger)size {
+	_batchSize = size;
+}
+
+- (NSUInteger) statements {
+	return _statements;
+}
+
+- (NSUInteger) batches {
+	return _batches;
+}
+
+- (double) progress {
+	if (_isFinished) {
+		return 1.0;
+	}
+	unsigned long long size = [_splitter size];
+	return (size > 0) ? MIN((double)[_splitter offset] / (double)size, 1.0) : 0.0;
+}
+
+- (BOOL) isFinished {
+	return _isFinished;
+}
+
+- (BOOL) run: (ZIMSqlStatementSplitter *)splitter {
+	// Note: Statements that manage transactions (or cannot run or take effect inside of one) end the open batch
+	// (e.g. "PRAGMA foreign_keys" is a no-op inside of a transaction).
+	NSSet *commands = [NSSet setWithObjects: @"BEGIN", @"COMMIT", @"END", @"ROLLBACK", @"SAVEPOINT", @"RELEASE", @"VACUUM", @"ATTACH", @"DETACH", @"PRAGMA", nil];
+	NSCharacterSet *delimiters = [NSCharacterSet characterSetWithCharactersInString: @" ;\"'`[]\n\r\t"];
+
+	_splitter = splitter;
+	_statements = 0;
+	_batches = 0;
+	_isFinished = NO;
+	atomic_store(&_isCancelled, NO);
+
+	BOOL isOpen = NO;
+	NSUInteger count = 0;
+	@try {
+		while (!atomic_load(&_isCancelled)) {
+			NSString *sql = [splitter nextStatement];
+			if (sql == nil) {
+				_isFinished = YES;
+				break;
+			}
+			NSString *command = [[NSString firstTokenInString: sql scanUpToCharactersFromSet: delimiters] uppercaseString];
+			BOOL isControl = [commands containsObject: command];
+			if (isOpen && isControl) {
+				[_connection commitTransaction];
+				isOpen = NO;
+				count = 0;
+				if (![self didFinishBatch]) {
+					// Note: The statement has already been split, so it is run before the runner stops.
+					atomic_store(&_isCancelled, YES);
+				}
+			}
+			if (!isOpen && !isControl && (_batchSize > 0) && ![_connection isInTransaction]) {
+				[_connection beginTransaction];
+				isOpen = YES;
+			}
+			[_connection execute: sql];
+			_statements++;
+			if (isOpen) {
+				count++;
+				if (count >= _batchSize) {
+					[_connection commitTransaction];
+					isOpen = NO;
+					count = 0;
+					if (![self didFinishBatch]) {
+						break;
+					}
+				}
+			}
+			else if (!atomic_load(&_isCancelled) && ![_connection isInTransaction]) { // i.e. the statement has been committed
+				if (![self didFinishBatch]) {
+					break;
+				}
+			}
+		}
+		if (isOpen) {
+			[_connection commitTransaction];
+			isOpen = NO;
+			count = 0;
+			[self didFinishBatch];
+		}
+	}
+	@catch (NSException *exception) {
+		// Note: A transaction begun by the script itself is left for the caller to resolve.
+		if (isOpen) {
+			if ([_connection isInTransaction]) {
+				[_connection rollbackTransaction];
+			}
+			_statements -= count;
+		}
+		_isFinished = NO;
+		@throw [NSException exceptionWithName: @"ZIMDbException" reason: [NSString stringWithFormat: @"Failed to run statement %lu of script. %@", (unsigned long)[splitter count], [exception reason]] userInfo: nil];
+	}
+	if (_isFinished) {
+		if ((_delegate != nil) && [_delegate respondsToSelector: @selector(runnerDidFinishRunning:)]) {
+			[_delegate runnerDidFinishRunning: self];
+		}
+	}
+	return _isFinished;
+}
+
+- (BOOL) runFile: (NSString *)path {
+	return [self run: [[ZIMSqlStatementSplitter alloc] initWithContentsOfFile: path]];
+}
+
+- (void) cancel {
+	atomic_store(&_isCancelled, YES);
+}
+
+- (BOOL) didFinishBatch {
+	_batches++;
+	if ((_delegate != nil) && [_delegate respondsToSelector: @selector(runnerDidFinishBatch:)]) {
+		[_delegate runnerDidFinishBatch: self];
+	}
+	if ((_delegate != nil) && [_delegate respondsToSelector: @selector(runnerShouldContinue:)] && ![_delegate runnerShouldContinue: self]) {
+		return NO;
+	}
+	return YES;
+}
+
+@end
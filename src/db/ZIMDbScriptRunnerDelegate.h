@@ -0,0 +1,52 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+@class ZIMDbScriptRunner;
+
+/*!
+ @class					ZIMDbScriptRunnerDelegate
+ @discussion			This protocol specifies the methods that a delegate of ZIMDbScriptRunner should
+						implement.
+ @updated				2026-10-19
+ */
+@protocol ZIMDbScriptRunnerDelegate <NSObject>
+
+@optional
+/*!
+ @method				runnerDidFinishBatch:
+ @discussion			This method is called when a runner commits a batch.  The runner's statements and
+						progress can be used to report how much of the script has been run.
+ @param runner			The runner that is running the script.
+ @updated				2026-10-19
+ */
+- (void) runnerDidFinishBatch: (ZIMDbScriptRunner *)runner;
+/*!
+ @method				runnerShouldContinue:
+ @discussion			This method is called before a runner starts the next batch.
+ @param runner			The runner that is running the script.
+ @return				Whether the runner should continue.
+ @updated				2026-10-19
+ */
+- (BOOL) runnerShouldContinue: (ZIMDbScriptRunner *)runner;
+/*!
+ @method				runnerDidFinishRunning:
+ @discussion			This method is called when a runner has run every statement in the script.
+ @param runner			The runner that is running the script.
+ @updated				2026-10-19
+ */
+- (void) runnerDidFinishRunning: (ZIMDbScriptRunner *)runner;
+
+@end
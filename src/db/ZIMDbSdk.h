@@ -16,5 +16,14 @@
 
 #import "NSString+ZIMString.h"
 
+#import "ZIMDbBatchExecutor.h"
+#import "ZIMDbBatchExecutorDelegate.h"
 #import "ZIMDbConnection.h"
 #import "ZIMDbConnectionPool.h"
+#import "ZIMDbIndexAdvisor.h"
+#import "ZIMDbMaintenanceScheduler.h"
+#import "ZIMDbQueryPlan.h"
+#import "ZIMDbQueryPlanNode.h"
+#import "ZIMDbRetentionPolicy.h"
+#import "ZIMDbScriptRunner.h"
+#import "ZIMDbScriptRunnerDelegate.h"
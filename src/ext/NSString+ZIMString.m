@@ -19,11 +19,22 @@
 @implementation NSString (ZIMString)
 
 - (BOOL) matchRegex: (NSString *)pattern options: (NSRegularExpressionOptions)options {
-    NSError *error;
-    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern: pattern options: options error: &error];
-    if (regex == nil) {
-        return NO;
-    }
+	static NSCache *cache = nil;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		cache = [[NSCache alloc] init];
+		[cache setCountLimit: 64];
+	});
+	NSString *key = [NSString stringWithFormat: @"%lu:%@", (unsigned long)options, pattern];
+	NSRegularExpression *regex = [cache objectForKey: key];
+	if (regex == nil) {
+		NSError *error;
+		regex = [NSRegularExpression regularExpressionWithPattern: pattern options: options error: &error];
+		if (regex == nil) {
+			return NO;
+		}
+		[cache setObject: regex forKey: key];
+	}
     NSUInteger n = [regex numberOfMatchesInString: self options: 0 range: NSMakeRange(0, [self length])];
     return (n == 1);
 }
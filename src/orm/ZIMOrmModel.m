@@ -18,10 +18,61 @@
 #import <objc/runtime.h>
 #import "ZIMDbConnection.h"
 #import "ZIMOrmModel.h"
-#import "ZIMSqlDeleteStatement.h"
-#import "ZIMSqlInsertStatement.h"
 #import "ZIMSqlSelectStatement.h"
-#import "ZIMSqlUpdateStatement.h"
+
+#define ZIMOrmTemplateLoad							@"load"
+#define ZIMOrmTemplateExists						@"exists"
+#define ZIMOrmTemplateDelete						@"delete"
+#define ZIMOrmTemplateUpdate						@"update"
+#define ZIMOrmTemplateUpdateColumns					@"updateColumns"
+#define ZIMOrmTemplateInsert						@"insert"
+#define ZIMOrmTemplateInsertColumns					@"insertColumns"
+#define ZIMOrmTemplateInsertWithoutKey				@"insertWithoutKey"
+#define ZIMOrmTemplateInsertWithoutKeyColumns		@"insertWithoutKeyColumns"
+#define ZIMOrmTemplateIsReturning					@"isReturning"
+
+/*!
+ @category		ZIMOrmModel (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMOrmModel (Private)
+/*!
+ @method				templates
+ @discussion			This method will return the parameterized SQL statements used to load, save, and
+						delete a record of this model.  Because their shapes never change for a given model,
+						they are rendered once on first use and then cached for the lifetime of the process.
+ @return				The SQL statement templates.
+ @updated				2026-10-19
+ */
++ (NSDictionary *) templates;
+/*!
+ @method				connection
+ @discussion			This method will return the connection on which this model's templates are run.  The
+						connection stays open for the lifetime of the process so that the templates' prepared
+						statements are reused; callers must synchronize on it since it is shared by every model
+						with the same data source.
+ @return				The connection for this model's data source.
+ @updated				2026-10-19
+ */
++ (ZIMDbConnection *) connection;
+/*!
+ @method				valuesForColumns:
+ @discussion			This method will return the values assigned to the specified columns in order
+						so that they may be bound to a template's placeholders.
+ @param columns			The columns whose values are to be returned.
+ @return				The values assigned to the specified columns.
+ @updated				2026-10-19
+ */
+- (NSMutableArray *) valuesForColumns: (NSArray *)columns;
+/*!
+ @method				refresh:
+ @discussion			This method will assign the values of the specified record to this model.
+ @param record			The record whose values are to be assigned.
+ @updated				2026-10-19
+ */
+- (void) refresh: (NSDictionary *)record;
+@end
 
 @implementation ZIMOrmModel
 
@@ -98,20 +149,25 @@
 	}
 	NSArray *primaryKey = [[self class] primaryKey];
 	if ((primaryKey != nil) && ([primaryKey count] > 0)) {
-		ZIMSqlDeleteStatement *sql = [[ZIMSqlDeleteStatement alloc] init];
-		[sql table: [[self class] table]];
 		for (NSString *column in primaryKey) {
-			id value = [self valueForKey: column];
-			if (value == nil) {
+			if ([self valueForKey: column] == nil) {
 				@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Failed to delete record because column '%@' is not assigned a value.", column] userInfo: nil];
 			}
-			[sql where: column operator: ZIMSqlOperatorEqualTo value: value];
 		}
-		ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: [[self class] dataSource]];
-		[connection beginTransaction];
-		[connection execute: [sql statement]];
-		[connection commitTransaction];
-		[connection close];
+		ZIMDbConnection *connection = [[self class] connection];
+		@synchronized(connection) {
+			[connection beginTransaction];
+			@try {
+				[connection execute: [[[self class] templates] objectForKey: ZIMOrmTemplateDelete] withParameters: [self valuesForColumns: primaryKey]];
+				[connection commitTransaction];
+			}
+			@catch (NSException *exception) {
+				if ([connection isInTransaction]) {
+					[connection rollbackTransaction];
+				}
+				@throw;
+			}
+		}
 		_saved = nil;
 	}
 	else {
@@ -128,24 +184,20 @@
 	}
 	NSArray *primaryKey = [[self class] primaryKey];
 	if ((primaryKey != nil) && ([primaryKey count] > 0)) {
-		ZIMSqlSelectStatement *sql = [[ZIMSqlSelectStatement alloc] init];
-		[sql from: [[self class] table]];
 		for (NSString *column in primaryKey) {
-			id value = [self valueForKey: column];
-			if (value == nil) {
+			if ([self valueForKey: column] == nil) {
 				@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Failed to load record because column '%@' is not assigned a value.", column] userInfo: nil];
 			}
-			[sql where: column operator: ZIMSqlOperatorEqualTo value: value];
 		}
-		[sql limit: 1];
-		NSArray *records = [ZIMDbConnection dataSource: [[self class] dataSource] query: [sql statement]];
+		ZIMDbConnection *connection = [[self class] connection];
+		NSArray *records = nil;
+		@synchronized(connection) {
+			records = [connection query: [[[self class] templates] objectForKey: ZIMOrmTemplateLoad] withParameters: [self valuesForColumns: primaryKey]];
+		}
 		if ([records count] != 1) {
 			@throw [NSException exceptionWithName: @"ZIMOrmException" reason: @"Failed to load record because the declared primary is invalid." userInfo: nil];
 		}
-		NSDictionary *record = [records objectAtIndex: 0];
-		for (NSString *column in record) {
-			[self setValue: [record valueForKey: column] forKey: column];
-		}
+		[self refresh: [records objectAtIndex: 0]];
 		_saved = [self hashCode];
 	}
 	else {
@@ -165,75 +217,72 @@
 	}
 	NSArray *primaryKey = [[self class] primaryKey];
 	if ((primaryKey != nil) && ([primaryKey count] > 0)) {
-		ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: [[self class] dataSource]];
-		[connection beginTransaction];
-		NSMutableDictionary *columns = [[NSMutableDictionary alloc] initWithDictionary: [[self class] columns]];
-		NSString *hashCode = [self hashCode];
-		BOOL doInsert = (hashCode == nil);
-		if (!doInsert) {
-			doInsert = ((_saved == nil) || ![_saved isEqualToString: hashCode]);
-			if (doInsert) {
-				ZIMSqlSelectStatement *select = [[ZIMSqlSelectStatement alloc] init];
-				[select column: @"1" alias: @"IsFound"];
-				[select from: [[self class] table]];
-				for (NSString *column in primaryKey) {
-					[select where: column operator: ZIMSqlOperatorEqualTo value: [self valueForKey: column]];
-				}
-				[select limit: 1];
-				NSArray *records = [connection query: [select statement]];
-				doInsert = ([records count] == 0);
-			}
-			if (!doInsert) {
-				for (NSString *column in primaryKey) {
-					[columns removeObjectForKey: column];
-				}
-				if ([columns count] > 0) {
-					ZIMSqlUpdateStatement *update = [[ZIMSqlUpdateStatement alloc] init];
-					[update table: [[self class] table]];
-					for (NSString *column in columns) {
-						[update column: column value: [self valueForKey: column]];
+		NSDictionary *templates = [[self class] templates];
+		ZIMDbConnection *connection = [[self class] connection];
+		@synchronized(connection) {
+			[connection beginTransaction];
+			@try {
+				NSString *hashCode = [self hashCode];
+				BOOL doInsert = (hashCode == nil);
+				if (!doInsert) {
+					doInsert = ((_saved == nil) || ![_saved isEqualToString: hashCode]);
+					if (doInsert) {
+						NSArray *records = [connection query: [templates objectForKey: ZIMOrmTemplateExists] withParameters: [self valuesForColumns: primaryKey]];
+						doInsert = ([records count] == 0);
 					}
-					for (NSString *column in primaryKey) {
-						NSString *value = [self valueForKey: column];
-						if (value == nil) {
-							[connection rollbackTransaction];
-							[connection close];
-							@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Failed to save record because column '%@' has no assigned value.", column] userInfo: nil];
+					if (!doInsert) {
+						NSString *update = [templates objectForKey: ZIMOrmTemplateUpdate];
+						if (update != nil) {
+							NSMutableArray *values = [self valuesForColumns: [templates objectForKey: ZIMOrmTemplateUpdateColumns]];
+							[values addObjectsFromArray: [self valuesForColumns: primaryKey]];
+							if ([[templates objectForKey: ZIMOrmTemplateIsReturning] boolValue]) {
+								NSArray *records = [connection execute: update withParameters: values returningAsObject: [NSMutableDictionary class]];
+								if ([records count] > 0) {
+									[self refresh: [records objectAtIndex: 0]];
+								}
+							}
+							else {
+								[connection execute: update withParameters: values];
+							}
+							_saved = [self hashCode];
 						}
-						[update where: column operator: ZIMSqlOperatorEqualTo value: value];
 					}
-					[connection execute: [update statement]];
-					_saved = hashCode;
 				}
-			}
-		}
-		if (doInsert) {
-			if ([[self class] isAutoIncremented] && (hashCode == nil)) {
-				for (NSString *column in primaryKey) {
-					[columns removeObjectForKey: column];
-				}
-			}
-			if ([columns count] > 0) {
-				ZIMSqlInsertStatement *insert = [[ZIMSqlInsertStatement alloc] init];
-				[insert into: [[self class] table]];
-				for (NSString *column in columns) {
-					NSString *value = [self valueForKey: column];
-					if ((value == nil) && [primaryKey containsObject: column]) {
-						[connection rollbackTransaction];
-						[connection close];
-						@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Failed to save record because column '%@' has no assigned value.", column] userInfo: nil];
+				if (doInsert) {
+					BOOL doGenerateKey = ([[self class] isAutoIncremented] && (hashCode == nil));
+					NSString *insert = [templates objectForKey: (doGenerateKey) ? ZIMOrmTemplateInsertWithoutKey : ZIMOrmTemplateInsert];
+					if (insert != nil) {
+						for (NSString *column in primaryKey) {
+							if (!doGenerateKey && ([self valueForKey: column] == nil)) {
+								@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Failed to save record because column '%@' has no assigned value.", column] userInfo: nil];
+							}
+						}
+						NSArray *columns = [templates objectForKey: (doGenerateKey) ? ZIMOrmTemplateInsertWithoutKeyColumns : ZIMOrmTemplateInsertColumns];
+						if ([[templates objectForKey: ZIMOrmTemplateIsReturning] boolValue]) {
+							// Note: The returned row carries the generated key along with any defaults and trigger effects.
+							NSArray *records = [connection execute: insert withParameters: [self valuesForColumns: columns] returningAsObject: [NSMutableDictionary class]];
+							if ([records count] > 0) {
+								[self refresh: [records objectAtIndex: 0]];
+							}
+						}
+						else {
+							NSNumber *result = [connection execute: insert withParameters: [self valuesForColumns: columns]];
+							if (doGenerateKey) {
+								[self setValue: result forKey: [primaryKey objectAtIndex: 0]];
+							}
+						}
+						_saved = [self hashCode];
 					}
-					[insert column: column value: value];
 				}
-				NSNumber *result = [connection execute: [insert statement]];
-				if ([[self class] isAutoIncremented] && (hashCode == nil)) {
-					[self setValue: result forKey: [primaryKey objectAtIndex: 0]];
+				[connection commitTransaction];
+			}
+			@catch (NSException *exception) {
+				if ([connection isInTransaction]) {
+					[connection rollbackTransaction];
 				}
-				_saved = [self hashCode];
+				@throw;
 			}
 		}
-		[connection commitTransaction];
-		[connection close];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMOrmException" reason: @"Failed to save record because no primary key has been declared." userInfo: nil];
@@ -320,4 +369,114 @@
 	return YES;
 }
 
++ (NSDictionary *) templates {
+	static NSMutableDictionary *cache = nil;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		cache = [[NSMutableDictionary alloc] init];
+	});
+	NSString *key = NSStringFromClass(self);
+	@synchronized(cache) {
+		NSDictionary *templates = [cache objectForKey: key];
+		if (templates != nil) {
+			return templates;
+		}
+	}
+
+	NSMutableDictionary *templates = [[NSMutableDictionary alloc] init];
+	BOOL isReturning = (ZIMSqlLibraryVersion() >= 3035000); // i.e. the returning clause was added in SQLite 3.35.0
+	[templates setObject: [NSNumber numberWithBool: isReturning] forKey: ZIMOrmTemplateIsReturning];
+	NSString *table = [ZIMSqlExpression prepareIdentifier: [self table] maxCount: 2];
+	NSArray *primaryKey = [self primaryKey];
+	NSMutableArray *predicates = [[NSMutableArray alloc] initWithCapacity: [primaryKey count]];
+	for (NSString *column in primaryKey) {
+		[predicates addObject: [NSString stringWithFormat: @"%@ = ?", [ZIMSqlExpression prepareIdentifier: column maxCount: 1]]];
+	}
+	NSString *where = [predicates componentsJoinedByString: @" AND "];
+
+	[templates setObject: [NSString stringWithFormat: @"SELECT * FROM %@ WHERE %@ LIMIT 1;", table, where] forKey: ZIMOrmTemplateLoad];
+	[templates setObject: [NSString stringWithFormat: @"SELECT 1 AS [IsFound] FROM %@ WHERE %@ LIMIT 1;", table, where] forKey: ZIMOrmTemplateExists];
+	[templates setObject: [NSString stringWithFormat: @"DELETE FROM %@ WHERE %@;", table, where] forKey: ZIMOrmTemplateDelete];
+
+	// Note: The columns are sorted so that the order of the placeholders is deterministic.
+	NSArray *columns = [[[self columns] allKeys] sortedArrayUsingSelector: @selector(compare:)];
+	NSString *returning = @"";
+	if (isReturning) { // i.e. only the model's columns are returned since each is assigned to the model
+		NSMutableArray *identifiers = [[NSMutableArray alloc] initWithCapacity: [columns count]];
+		for (NSString *column in columns) {
+			[identifiers addObject: [ZIMSqlExpression prepareIdentifier: column maxCount: 1]];
+		}
+		returning = [NSString stringWithFormat: @" RETURNING %@", [identifiers componentsJoinedByString: @", "]];
+	}
+	NSMutableArray *updateColumns = [[NSMutableArray alloc] initWithCapacity: [columns count]];
+	NSMutableArray *assignments = [[NSMutableArray alloc] initWithCapacity: [columns count]];
+	for (NSString *column in columns) {
+		if (![primaryKey containsObject: column]) {
+			[updateColumns addObject: column];
+			[assignments addObject: [NSString stringWithFormat: @"%@ = ?", [ZIMSqlExpression prepareIdentifier: column maxCount: 1]]];
+		}
+	}
+	[templates setObject: updateColumns forKey: ZIMOrmTemplateUpdateColumns];
+	if ([assignments count] > 0) {
+		[templates setObject: [NSString stringWithFormat: @"UPDATE %@ SET %@ WHERE %@%@;", table, [assignments componentsJoinedByString: @", "], where, returning] forKey: ZIMOrmTemplateUpdate];
+	}
+
+	NSArray *variants = [NSArray arrayWithObjects: columns, updateColumns, nil];
+	NSArray *keys = [NSArray arrayWithObjects: ZIMOrmTemplateInsert, ZIMOrmTemplateInsertWithoutKey, nil];
+	NSArray *columnKeys = [NSArray arrayWithObjects: ZIMOrmTemplateInsertColumns, ZIMOrmTemplateInsertWithoutKeyColumns, nil];
+	for (NSUInteger i = 0; i < [variants count]; i++) {
+		NSArray *insertColumns = [variants objectAtIndex: i];
+		[templates setObject: insertColumns forKey: [columnKeys objectAtIndex: i]];
+		if ([insertColumns count] > 0) {
+			NSMutableArray *identifiers = [[NSMutableArray alloc] initWithCapacity: [insertColumns count]];
+			NSMutableArray *placeholders = [[NSMutableArray alloc] initWithCapacity: [insertColumns count]];
+			for (NSString *column in insertColumns) {
+				[identifiers addObject: [ZIMSqlExpression prepareIdentifier: column maxCount: 1]];
+				[placeholders addObject: @"?"];
+			}
+			[templates setObject: [NSString stringWithFormat: @"INSERT INTO %@ (%@) VALUES (%@)%@;", table, [identifiers componentsJoinedByString: @", "], [placeholders componentsJoinedByString: @", "], returning] forKey: [keys objectAtIndex: i]];
+		}
+	}
+
+	@synchronized(cache) {
+		[cache setObject: templates forKey: key];
+	}
+	return templates;
+}
+
++ (ZIMDbConnection *) connection {
+	static NSMutableDictionary *connections = nil;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		connections = [[NSMutableDictionary alloc] init];
+	});
+	NSString *dataSource = [self dataSource];
+	@synchronized(connections) {
+		ZIMDbConnection *connection = [connections objectForKey: dataSource];
+		if (connection == nil) {
+			connection = [[ZIMDbConnection alloc] initWithDataSource: dataSource];
+			[connections setObject: connection forKey: dataSource];
+		}
+		else {
+			[connection open];
+		}
+		return connection;
+	}
+}
+
+- (NSMutableArray *) valuesForColumns: (NSArray *)columns {
+	NSMutableArray *values = [[NSMutableArray alloc] initWithCapacity: [columns count]];
+	for (NSString *column in columns) {
+		id value = [self valueForKey: column];
+		[values addObject: (value != nil) ? value : [NSNull null]];
+	}
+	return values;
+}
+
+- (void) refresh: (NSDictionary *)record {
+	for (NSString *column in record) {
+		[self setValue: [record valueForKey: column] forKey: column];
+	}
+}
+
 @end
@@ -28,6 +28,7 @@
 	@protected
 		Class _model;
 		ZIMSqlSelectStatement *_sql;
+		NSUInteger _hierarchies;
 
 }
 /*!
@@ -38,6 +39,24 @@
  @updated				2011-07-14
  */
 - (id) initWithModel: (Class)model;
+/*!
+ @method				indexedBy:
+ @discussion			This method will require the query planner to use the specified index to look up
+						records of the model.
+ @param index			The index to be used.  An exception is raised if it has not been declared on
+						the model's table.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) indexedBy: (NSString *)index;
+/*!
+ @method				notIndexed
+ @discussion			This method will prevent the query planner from using any index to look up
+						records of the model.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) notIndexed;
 /*!
  @method				join:
  @discussion			This method will add a join clause to the SQL statement.
@@ -70,6 +89,24 @@
  @updated				2011-10-19
  */
 - (void) join: (NSString *)table alias: (NSString *)alias type: (NSString *)type; // type of JOIN: CROSS, INNER, LEFT, etc.
+/*!
+ @method				join:indexedBy:
+ @discussion			This method will add a join clause to the SQL statement that requires the query
+						planner to use the specified index to look up rows in the joined table.
+ @param table			The table to used in the clause.
+ @param index			The index to be used.  An exception is raised if it has not been declared on
+						the table.
+ @updated				2026-10-19
+ */
+- (void) join: (NSString *)table indexedBy: (NSString *)index;
+/*!
+ @method				forceJoinOrder:
+ @discussion			This method will force the query planner to join the tables in the order that
+						they are declared.
+ @param force			This will determine whether the join order should be forced.
+ @updated				2026-10-19
+ */
+- (void) forceJoinOrder: (BOOL)force;
 /*!
  @method				joinOn:operator:column:
  @discussion			This method will add a join condition to the SQL statement.
@@ -86,6 +123,30 @@
  @updated				2011-04-02
  */
 - (void) joinUsing: (NSString *)column;
+/*!
+ @method				descendantsOf:key:parentKey:
+ @discussion			This method will restrict the result set to the specified record and every record
+						beneath it in the hierarchy declared by the parent key (e.g. a category tree).  The
+						hierarchy is walked by SQLite with a recursive common table expression, so the whole
+						tree is loaded by a single query.
+ @param value			The value of the key that identifies the record at the root of the tree.
+ @param key				The column that identifies a record.
+ @param parentKey		The column that references the record's parent.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_with.html#recursive_common_table_expressions
+ */
+- (void) descendantsOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey;
+/*!
+ @method				ancestorsOf:key:parentKey:
+ @discussion			This method will restrict the result set to the specified record and every record
+						above it in the hierarchy declared by the parent key (e.g. a chain of managers).
+ @param value			The value of the key that identifies the record at the bottom of the chain.
+ @param key				The column that identifies a record.
+ @param parentKey		The column that references the record's parent.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_with.html#recursive_common_table_expressions
+ */
+- (void) ancestorsOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey;
 /*!
  @method				whereBlock:
  @discussion			This method will start or end a block.
@@ -253,10 +314,22 @@
 - (void) offset: (NSInteger)offset;
 /*!
  @method				query
- @discussion			This method will return the SQL statement.
- @return				The SQL statement that was constructed.
- @updated				2011-10-23
+ @discussion			This method will execute the SQL statement with its values bound as parameters.
+ @return				The result set (i.e. an array of records).
+ @updated				2026-10-19
  */
 - (NSArray *) query;
+/*!
+ @method				queryAfter:nextCursor:
+ @discussion			This method will execute the SQL statement to fetch the page of records that follows
+						the specified cursor (i.e. keyset pagination).  The order by clause determines the
+						pagination order and should be unique (e.g. end with the primary key), while the limit
+						determines the page size.
+ @param cursor			The cursor of the previous page or nil to fetch the first page.
+ @param nextCursor		Will be set to the cursor of the fetched page or nil if the page is empty.
+ @return				The result set (i.e. an array of records).
+ @updated				2026-10-19
+ */
+- (NSArray *) queryAfter: (NSArray *)cursor nextCursor: (NSArray **)nextCursor;
 
 @end
@@ -18,6 +18,35 @@
 #import "ZIMOrmModel.h"
 #import "ZIMOrmSelectStatement.h"
 
+/*!
+ @category		ZIMOrmSelectStatement (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMOrmSelectStatement (Private)
+/*!
+ @method				hierarchyOf:key:parentKey:descending:as:
+ @discussion			This method will restrict the result set to the records reachable from the
+						specified record by walking the parent key in the specified direction.
+ @param value			The value of the key that identifies the record at which to start.
+ @param key				The column that identifies a record.
+ @param parentKey		The column that references the record's parent.
+ @param descending		This will determine whether to walk down (i.e. to children) or up (i.e. to parents).
+ @param table			The name of the common table expression, which must be unique within the statement.
+ @updated				2026-10-19
+ */
+- (void) hierarchyOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey descending: (BOOL)descending as: (NSString *)table;
+/*!
+ @method				validateIndex:onTable:
+ @discussion			This method will raise an exception if the specified index has not been declared
+						on the specified table.
+ @param index			The name of the index.
+ @param table			The name of the table.
+ @updated				2026-10-19
+ */
+- (void) validateIndex: (NSString *)index onTable: (NSString *)table;
+@end
+
 @implementation ZIMOrmSelectStatement
 
 - (id) initWithModel: (Class)model {
@@ -28,10 +57,29 @@
 		_model = model;
 		_sql = [[ZIMSqlSelectStatement alloc] init];
 		[_sql from: [model table]];
+		_hierarchies = 0;
 	}
 	return self;
 }
 
+- (void) indexedBy: (NSString *)index {
+	[self validateIndex: index onTable: [_model table]];
+	[_sql indexedBy: index];
+}
+
+- (void) notIndexed {
+	[_sql notIndexed];
+}
+
+- (void) join: (NSString *)table indexedBy: (NSString *)index {
+	[self validateIndex: index onTable: table];
+	[_sql join: table indexedBy: index];
+}
+
+- (void) forceJoinOrder: (BOOL)force {
+	[_sql forceJoinOrder: force];
+}
+
 - (void) join: (NSString *)table {
 	[_sql join: table];
 }
@@ -56,6 +104,14 @@
 	[_sql joinUsing: column];
 }
 
+- (void) descendantsOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey {
+	[self hierarchyOf: value key: key parentKey: parentKey descending: YES as: [NSString stringWithFormat: @"zim_descendants_%lu", (unsigned long)_hierarchies++]];
+}
+
+- (void) ancestorsOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey {
+	[self hierarchyOf: value key: key parentKey: parentKey descending: NO as: [NSString stringWithFormat: @"zim_ancestors_%lu", (unsigned long)_hierarchies++]];
+}
+
 - (void) whereBlock: (NSString *)brace {
 	[_sql whereBlock: brace];
 }
@@ -138,9 +194,59 @@
 
 - (NSArray *) query {
 	ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: [_model dataSource] withMultithreadingSupport: NO];
-	NSArray *records = [connection query: [_sql statement] asObject: _model];
+	NSArray *records = [connection query: [_sql parameterizedStatement] withParameters: [_sql parameters] temporaryTables: [_sql temporaryTables] asObject: _model];
 	[connection close];
 	return records;
 }
 
+- (NSArray *) queryAfter: (NSArray *)cursor nextCursor: (NSArray **)nextCursor {
+	ZIMSqlSelectStatement *sql = [_sql copy];
+	[sql seekAfter: cursor];
+	ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: [_model dataSource] withMultithreadingSupport: NO];
+	NSArray *records = [connection query: [sql parameterizedStatement] withParameters: [sql parameters] temporaryTables: [sql temporaryTables] asObject: _model];
+	[connection close];
+	if (nextCursor != NULL) {
+		*nextCursor = ([records count] > 0) ? [sql cursorForRecord: [records lastObject]] : nil;
+	}
+	return records;
+}
+
+- (void) hierarchyOf: (id)value key: (NSString *)key parentKey: (NSString *)parentKey descending: (BOOL)descending as: (NSString *)table {
+	NSString *node = @"zim_node";
+
+	ZIMSqlSelectStatement *step = [[ZIMSqlSelectStatement alloc] init];
+	[step column: [NSString stringWithFormat: @"%@.%@", node, key]];
+	[step column: [NSString stringWithFormat: @"%@.%@", node, parentKey]];
+	[step from: [_model table] alias: node];
+	[step join: table];
+	if (descending) {
+		[step joinOn: [NSString stringWithFormat: @"%@.%@", node, parentKey] operator: ZIMSqlOperatorEqualTo column: [NSString stringWithFormat: @"%@.%@", table, key]];
+	}
+	else {
+		[step joinOn: [NSString stringWithFormat: @"%@.%@", node, key] operator: ZIMSqlOperatorEqualTo column: [NSString stringWithFormat: @"%@.%@", table, parentKey]];
+	}
+
+	ZIMSqlSelectStatement *tree = [[ZIMSqlSelectStatement alloc] init];
+	[tree column: key];
+	[tree column: parentKey];
+	[tree from: [_model table]];
+	[tree where: key operator: ZIMSqlOperatorEqualTo value: value];
+	[tree combine: [step statement] operator: @"UNION"]; // i.e. "UNION" discards repeated rows, which stops a cycle
+	[_sql withRecursive: tree as: table];
+
+	ZIMSqlSelectStatement *keys = [[ZIMSqlSelectStatement alloc] init];
+	[keys column: key];
+	[keys from: table];
+	[_sql where: [NSString stringWithFormat: @"%@.%@", [_model table], key] operator: ZIMSqlOperatorIn value: keys]; // i.e. the key may be ambiguous once tables are joined
+}
+
+- (void) validateIndex: (NSString *)index onTable: (NSString *)table {
+	ZIMDbConnection *connection = [[ZIMDbConnection alloc] initWithDataSource: [_model dataSource] withMultithreadingSupport: NO];
+	BOOL hasIndex = [connection hasIndex: index onTable: table];
+	[connection close];
+	if (!hasIndex) {
+		@throw [NSException exceptionWithName: @"ZIMOrmException" reason: [NSString stringWithFormat: @"Index '%@' has not been declared on table '%@'.", index, table] userInfo: nil];
+	}
+}
+
 @end
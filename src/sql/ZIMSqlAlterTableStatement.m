@@ -105,10 +105,20 @@
 }
 
 - (NSString *) statement {
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 64 + [_clause length]];
 	if ([_clause hasPrefix: @"UPDATE"]) {
-		return [NSString stringWithFormat: @"%@ WHERE [name] = %@;", _clause, [ZIMSqlExpression prepareValue: _table]];
+		[sql appendString: _clause];
+		[sql appendCString: " WHERE [name] = "];
+		[sql appendQuotedString: _table];
 	}
-	return [NSString stringWithFormat: @"ALTER TABLE %@ %@;", [ZIMSqlExpression prepareIdentifier: _table maxCount: 2], _clause];
+	else {
+		[sql appendCString: "ALTER TABLE "];
+		[sql appendString: [ZIMSqlExpression prepareIdentifier: _table maxCount: 2]];
+		[sql appendCString: " "];
+		[sql appendString: _clause];
+	}
+	[sql appendCString: ";"];
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
@@ -30,7 +30,11 @@
 }
 
 - (NSString *) statement {
-	return [NSString stringWithFormat: @"ANALYZE %@;", _table];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
+	[sql appendCString: "ANALYZE "];
+	[sql appendString: _table];
+	[sql appendCString: ";"];
+	return [sql string];
 }
 
 @end
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import "ZIMSqlExpression.h"
+
+// Condition Types
+#define ZIMSqlConditionTypeBetween				@"BETWEEN"
+#define ZIMSqlConditionTypeBind					@"BIND"
+#define ZIMSqlConditionTypeColumn				@"COLUMN"
+#define ZIMSqlConditionTypeComparison			@"COMPARISON"
+#define ZIMSqlConditionTypeGroup				@"GROUP"
+#define ZIMSqlConditionTypeIn					@"IN"
+#define ZIMSqlConditionTypeList					@"LIST"
+#define ZIMSqlConditionTypeLiteral				@"LITERAL"
+#define ZIMSqlConditionTypeSubquery				@"SUBQUERY"
+
+@class ZIMSqlSelectStatement;
+
+/*!
+ @class					ZIMSqlCondition
+ @discussion			This class represents a node in the expression tree of a WHERE, HAVING, or ON clause.
+						Leaf nodes (i.e. columns, literals, binds, lists, and subqueries) are immutable, whereas
+						a group node collects predicates joined by connectors and may be nested using braces.
+						The tree is rendered in a single pass; values are either escaped as literals or bound
+						as parameters.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_expr.html
+ */
+@interface ZIMSqlCondition : NSObject <NSCopying> {
+
+	@protected
+		NSString *_type;
+		NSString *_operator;
+		id _value;
+		NSMutableArray *_operands;
+		NSMutableArray *_connectors;
+		BOOL _open;
+
+}
+/*!
+ @method				column:
+ @discussion			This method will create a node that references a column.
+ @param identifier		The prepared identifier of the column.
+ @return				A node that references the column.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) column: (NSString *)identifier;
+/*!
+ @method				literal:
+ @discussion			This method will create a node for a value that is always rendered as a literal.
+ @param value			The value to be rendered.
+ @return				A node that represents the literal.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) literal: (id)value;
+/*!
+ @method				bind:
+ @discussion			This method will create a node for a value that is bound as a parameter when the
+						statement is parameterized.
+ @param value			The value to be bound.
+ @return				A node that represents the bound value.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) bind: (id)value;
+/*!
+ @method				list:
+ @discussion			This method will create a node for a parenthesized list of values.
+ @param values			The values in the list.
+ @return				A node that represents the list.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) list: (NSArray *)values;
+/*!
+ @method				subquery:
+ @discussion			This method will create a node for a subquery.
+ @param statement		The select statement to be used as a subquery.
+ @return				A node that represents the subquery.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) subquery: (ZIMSqlSelectStatement *)statement;
+/*!
+ @method				operand:
+ @discussion			This method will create the appropriate node for a value (i.e. NULL is rendered as
+						a literal, an array as a list, a select statement as a subquery, and any other value
+						is bound).
+ @param value			The value to be wrapped.
+ @return				A node that represents the value.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) operand: (id)value;
+/*!
+ @method				comparison:operator:operand:
+ @discussion			This method will create a node that compares two operands.
+ @param left			The left operand.
+ @param operator		The operator to be used.
+ @param right			The right operand.
+ @return				A node that represents the comparison.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) comparison: (ZIMSqlCondition *)left operator: (NSString *)operator operand: (ZIMSqlCondition *)right;
+/*!
+ @method				membership:operator:operand:
+ @discussion			This method will create a node that tests for membership.  A list with only one
+						value is folded into an equality test.
+ @param left			The left operand.
+ @param operator		The operator to be used; it is either "IN" or "NOT IN".
+ @param right			Either a list or a subquery.
+ @return				A node that represents the membership test.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) membership: (ZIMSqlCondition *)left operator: (NSString *)operator operand: (ZIMSqlCondition *)right;
+/*!
+ @method				between:operator:lower:upper:
+ @discussion			This method will create a node that tests for a range.
+ @param left			The left operand.
+ @param operator		The operator to be used; it is either "BETWEEN" or "NOT BETWEEN".
+ @param lower			The lower bound.
+ @param upper			The upper bound.
+ @return				A node that represents the range test.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) between: (ZIMSqlCondition *)left operator: (NSString *)operator lower: (ZIMSqlCondition *)lower upper: (ZIMSqlCondition *)upper;
+/*!
+ @method				predicate:operator:column:
+ @discussion			This method will create a node that compares two columns.
+ @param column1			The column to be tested.
+ @param operator		The operator to be used.
+ @param column2			The column to be compared.
+ @return				A node that represents the predicate.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) predicate: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2;
+/*!
+ @method				predicate:operator:value:
+ @discussion			This method will create a node that compares a column against a value.
+ @param column			The column to be tested.
+ @param operator		The operator to be used.
+ @param value			The value to be compared.
+ @return				A node that represents the predicate.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) predicate: (NSString *)column operator: (NSString *)operator value: (id)value;
+/*!
+ @method				group
+ @discussion			This method will create an empty group.
+ @return				An empty group.
+ @updated				2026-10-19
+ */
++ (ZIMSqlCondition *) group;
+/*!
+ @method				type
+ @discussion			This method will return the type of node.
+ @return				The type of node.
+ @updated				2026-10-19
+ */
+- (NSString *) type;
+/*!
+ @method				count
+ @discussion			This method will return the number of conditions in the group.
+ @return				The number of conditions in the group.
+ @updated				2026-10-19
+ */
+- (NSUInteger) count;
+/*!
+ @method				isEmpty
+ @discussion			This method will determine whether the node would render nothing.
+ @return				Whether the node would render nothing.
+ @updated				2026-10-19
+ */
+- (BOOL) isEmpty;
+/*!
+ @method				addCondition:connector:
+ @discussion			This method will add a condition to the innermost open block of the group.
+ @param condition		The condition to be added.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ */
+- (void) addCondition: (ZIMSqlCondition *)condition connector: (NSString *)connector;
+/*!
+ @method				block:connector:
+ @discussion			This method will start or end a block within the group.
+ @param brace			The brace to be used; it is either an opening or closing brace.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ */
+- (void) block: (NSString *)brace connector: (NSString *)connector;
+/*!
+ @method				appendToWriter:parameters:
+ @discussion			This method will render the node.  Within a group, duplicate predicates in the same
+						conjunction, as well as duplicate conjunctions, are rendered only once.
+ @param sql				The writer to which the node will be appended.
+ @param parameters		The array to which the bound values will be appended.  When nil, the values
+						will be rendered as literals.
+ @updated				2026-10-19
+ */
+- (void) appendToWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters;
+/*!
+ @method				appendToWriter:parameters:temporaryTables:
+ @discussion			This method will render the node.  An "IN" list that is longer than a few values is
+						rendered as a single JSON parameter read through "json_each"; a very long list is
+						instead staged into a slot of the connection's indexed temporary table, which the
+						caller must populate before executing the SQL statement.  In literal mode, the
+						list is always rendered inline, however long it is.
+ @param sql				The writer to which the node will be appended.
+ @param parameters		The array to which the bound values will be appended.  When nil, the values
+						will be rendered as literals.
+ @param tables			The dictionary to which the values of any staged list will be added, keyed by
+						its slot.  When nil, lists are never staged.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/json1.html#jeach
+ */
+- (void) appendToWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables;
+
+@end
@@ -0,0 +1,446 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <math.h>
+#import <sqlite3.h> // Requires libsqlite3.dylib
+#import <stdatomic.h>
+#import "ZIMSqlCondition.h"
+#import "ZIMSqlSelectStatement.h"
+
+#if !defined(ZIMSqlConditionInlineListLimit)
+    #define ZIMSqlConditionInlineListLimit 100 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+#if !defined(ZIMSqlConditionStagedListLimit)
+    #define ZIMSqlConditionStagedListLimit 5000 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+/*!
+ @function				ZIMSqlConditionSupportsJson
+ @discussion			This function will determine whether SQLite was compiled with the JSON functions.
+ @return				Whether "json_each" is available.
+ @updated				2026-10-19
+ */
+static BOOL ZIMSqlConditionSupportsJson(void) {
+	static BOOL supportsJson = NO;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		supportsJson = ((ZIMSqlLibraryVersion() >= 3038000) || sqlite3_compileoption_used("ENABLE_JSON1"));
+	});
+	return supportsJson;
+}
+
+/*!
+ @function				ZIMSqlConditionNextSlot
+ @discussion			This function will allocate the slot under which a list is staged in a connection's
+						temporary table.  Because the slot is bound as a parameter, the SQL statement stays
+						the same no matter which list is staged.
+ @return				A slot that is unique within the process.
+ @updated				2026-10-19
+ */
+static NSNumber *ZIMSqlConditionNextSlot(void) {
+	static atomic_llong slot = 0;
+	return [NSNumber numberWithLongLong: atomic_fetch_add(&slot, 1)];
+}
+
+/*!
+ @function				ZIMSqlConditionIsJsonList
+ @discussion			This function will determine whether a list can be serialized as a JSON array.
+ @param values			The values in the list.
+ @return				Whether the list can be serialized.
+ @updated				2026-10-19
+ */
+static BOOL ZIMSqlConditionIsJsonList(NSArray *values) {
+	if (![NSJSONSerialization isValidJSONObject: values]) {
+		return NO;
+	}
+	for (id value in values) {
+		if ([value isKindOfClass: [NSNumber class]] && !isfinite([(NSNumber *)value doubleValue])) {
+			return NO; // i.e. JSON has no representation for NaN or infinity
+		}
+	}
+	return YES;
+}
+
+/*!
+ @category		ZIMSqlCondition (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMSqlCondition (Private)
+/*!
+ @method			initWithType:operator:value:operands:
+ @discussion		This method will initialize a node of the specified type.
+ @param type		The type of node.
+ @param operator	The operator used by the node, if any.
+ @param value		The value held by the node, if any.
+ @param operands	The child nodes of the node, if any.
+ @return			An instance of this class.
+ @updated			2026-10-19
+ */
+- (id) initWithType: (NSString *)type operator: (NSString *)operator value: (id)value operands: (NSArray *)operands;
+/*!
+ @method			innermostGroup
+ @discussion		This method will return the innermost block that is still open.
+ @return			The innermost open block, which may be the receiver.
+ @updated			2026-10-19
+ */
+- (ZIMSqlCondition *) innermostGroup;
+/*!
+ @method			listValues
+ @discussion		This method will return the raw values of a list, provided that every value in the
+					list is either a string, a number, or NULL.
+ @return			The raw values of the list or nil if the list cannot be flattened.
+ @updated			2026-10-19
+ */
+- (NSArray *) listValues;
+@end
+
+@implementation ZIMSqlCondition
+
+- (id) initWithType: (NSString *)type operator: (NSString *)operator value: (id)value operands: (NSArray *)operands {
+	if ((self = [super init])) {
+		_type = type;
+		_operator = operator;
+		_value = value;
+		_operands = (operands != nil) ? [operands mutableCopy] : [[NSMutableArray alloc] init];
+		_connectors = [[NSMutableArray alloc] init];
+		_open = NO;
+	}
+	return self;
+}
+
++ (ZIMSqlCondition *) column: (NSString *)identifier {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeColumn operator: nil value: identifier operands: nil];
+}
+
++ (ZIMSqlCondition *) literal: (id)value {
+	if (value == nil) {
+		value = [NSNull null];
+	}
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeLiteral operator: nil value: value operands: nil];
+}
+
++ (ZIMSqlCondition *) bind: (id)value {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeBind operator: nil value: value operands: nil];
+}
+
++ (ZIMSqlCondition *) list: (NSArray *)values {
+	NSMutableArray *operands = [[NSMutableArray alloc] initWithCapacity: [values count]];
+	for (id value in values) {
+		[operands addObject: [self operand: value]];
+	}
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeList operator: nil value: nil operands: operands];
+}
+
++ (ZIMSqlCondition *) subquery: (ZIMSqlSelectStatement *)statement {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeSubquery operator: nil value: statement operands: nil];
+}
+
++ (ZIMSqlCondition *) operand: (id)value {
+	if ([value isKindOfClass: [ZIMSqlCondition class]]) {
+		return (ZIMSqlCondition *)value;
+	}
+	else if ((value == nil) || [value isKindOfClass: [NSNull class]]) {
+		return [self literal: [NSNull null]];
+	}
+	else if ([value isKindOfClass: [ZIMSqlSelectStatement class]]) {
+		return [self subquery: (ZIMSqlSelectStatement *)value];
+	}
+	else if ([value isKindOfClass: [NSArray class]]) {
+		return [self list: (NSArray *)value];
+	}
+	return [self bind: value];
+}
+
++ (ZIMSqlCondition *) comparison: (ZIMSqlCondition *)left operator: (NSString *)operator operand: (ZIMSqlCondition *)right {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeComparison operator: [operator uppercaseString] value: nil operands: [NSArray arrayWithObjects: left, right, nil]];
+}
+
++ (ZIMSqlCondition *) membership: (ZIMSqlCondition *)left operator: (NSString *)operator operand: (ZIMSqlCondition *)right {
+	operator = [operator uppercaseString];
+	if ([right->_type isEqualToString: ZIMSqlConditionTypeList] && ([right->_operands count] == 1)) {
+		ZIMSqlCondition *value = [right->_operands objectAtIndex: 0];
+		if ([value->_type isEqualToString: ZIMSqlConditionTypeBind] || [value->_type isEqualToString: ZIMSqlConditionTypeLiteral]) {
+			return [self comparison: left operator: ([operator isEqualToString: ZIMSqlOperatorNotIn] ? ZIMSqlOperatorNotEqualTo : ZIMSqlOperatorEqualTo) operand: value];
+		}
+	}
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeIn operator: operator value: nil operands: [NSArray arrayWithObjects: left, right, nil]];
+}
+
++ (ZIMSqlCondition *) between: (ZIMSqlCondition *)left operator: (NSString *)operator lower: (ZIMSqlCondition *)lower upper: (ZIMSqlCondition *)upper {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeBetween operator: [operator uppercaseString] value: nil operands: [NSArray arrayWithObjects: left, lower, upper, nil]];
+}
+
++ (ZIMSqlCondition *) predicate: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 {
+	return [self comparison: [self column: [ZIMSqlExpression prepareIdentifier: column1]] operator: operator operand: [self column: [ZIMSqlExpression prepareIdentifier: column2]]];
+}
+
++ (ZIMSqlCondition *) predicate: (NSString *)column operator: (NSString *)operator value: (id)value {
+	if (value == nil) {
+		value = [NSNull null];
+	}
+	ZIMSqlCondition *left = [self column: [ZIMSqlExpression prepareIdentifier: column]];
+	operator = [operator uppercaseString];
+	if ([operator isEqualToString: ZIMSqlOperatorBetween] || [operator isEqualToString: ZIMSqlOperatorNotBetween]) {
+		if (![value isKindOfClass: [NSArray class]]) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
+		}
+		return [self between: left operator: operator lower: [self operand: [(NSArray *)value objectAtIndex: 0]] upper: [self operand: [(NSArray *)value objectAtIndex: 1]]];
+	}
+	else if ([operator isEqualToString: ZIMSqlOperatorIn] || [operator isEqualToString: ZIMSqlOperatorNotIn]) {
+		if (!([value isKindOfClass: [NSArray class]] || [value isKindOfClass: [ZIMSqlSelectStatement class]])) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
+		}
+		return [self membership: left operator: operator operand: [self operand: value]];
+	}
+	else if ([value isKindOfClass: [NSNull class]]) {
+		if ([operator isEqualToString: ZIMSqlOperatorEqualTo]) {
+			operator = ZIMSqlOperatorIs;
+		}
+		else if ([operator isEqualToString: ZIMSqlOperatorNotEqualTo] || [operator isEqualToString: @"!="]) {
+			operator = ZIMSqlOperatorIsNot;
+		}
+	}
+	return [self comparison: left operator: operator operand: [self operand: value]];
+}
+
++ (ZIMSqlCondition *) group {
+	return [[ZIMSqlCondition alloc] initWithType: ZIMSqlConditionTypeGroup operator: nil value: nil operands: nil];
+}
+
+- (NSString *) type {
+	return _type;
+}
+
+- (NSUInteger) count {
+	return [_operands count];
+}
+
+- (BOOL) isEmpty {
+	if ([_type isEqualToString: ZIMSqlConditionTypeGroup]) {
+		for (ZIMSqlCondition *condition in _operands) {
+			if (![condition isEmpty]) {
+				return NO;
+			}
+		}
+		return YES;
+	}
+	return NO;
+}
+
+- (ZIMSqlCondition *) innermostGroup {
+	ZIMSqlCondition *group = self;
+	ZIMSqlCondition *child = [group->_operands lastObject];
+	while ((child != nil) && child->_open) {
+		group = child;
+		child = [group->_operands lastObject];
+	}
+	return group;
+}
+
+- (NSArray *) listValues {
+	NSMutableArray *values = [[NSMutableArray alloc] initWithCapacity: [_operands count]];
+	for (ZIMSqlCondition *operand in _operands) {
+		if (!([operand->_type isEqualToString: ZIMSqlConditionTypeBind] || [operand->_type isEqualToString: ZIMSqlConditionTypeLiteral])) {
+			return nil;
+		}
+		id value = operand->_value;
+		if (!([value isKindOfClass: [NSString class]] || [value isKindOfClass: [NSNumber class]] || [value isKindOfClass: [NSNull class]])) {
+			return nil;
+		}
+		[values addObject: value];
+	}
+	return values;
+}
+
+- (void) addCondition: (ZIMSqlCondition *)condition connector: (NSString *)connector {
+	if (![_type isEqualToString: ZIMSqlConditionTypeGroup]) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only add a condition to a group." userInfo: nil];
+	}
+	connector = [ZIMSqlExpression prepareConnector: connector];
+	ZIMSqlCondition *group = [self innermostGroup];
+	[group->_operands addObject: condition];
+	[group->_connectors addObject: connector];
+}
+
+- (void) block: (NSString *)brace connector: (NSString *)connector {
+	if ([[ZIMSqlExpression prepareEnclosure: brace] isEqualToString: ZIMSqlEnclosureOpeningBrace]) {
+		ZIMSqlCondition *group = [ZIMSqlCondition group];
+		group->_open = YES;
+		[self addCondition: group connector: connector];
+	}
+	else {
+		ZIMSqlCondition *group = [self innermostGroup];
+		if (group == self) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare an opening brace before declaring a closing brace." userInfo: nil];
+		}
+		group->_open = NO;
+	}
+}
+
+- (void) appendToWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters {
+	[self appendToWriter: sql parameters: parameters temporaryTables: nil];
+}
+
+- (void) appendToWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables {
+	if ([_type isEqualToString: ZIMSqlConditionTypeGroup]) {
+		// Splits the group into its conjunctions (i.e. by "OR") while dropping duplicate predicates
+		NSMutableArray *conjunctions = [[NSMutableArray alloc] init];
+		NSMutableArray *conjunction = nil;
+		NSUInteger count = [_operands count];
+		for (NSUInteger i = 0; i < count; i++) {
+			ZIMSqlCondition *condition = [_operands objectAtIndex: i];
+			if ([condition isEmpty]) {
+				continue;
+			}
+			if ((conjunction == nil) || [[_connectors objectAtIndex: i] isEqualToString: ZIMSqlConnectorOr]) {
+				conjunction = [[NSMutableArray alloc] init];
+				[conjunctions addObject: conjunction];
+			}
+			if (![conjunction containsObject: condition]) {
+				[conjunction addObject: condition];
+			}
+		}
+		count = [conjunctions count];
+		BOOL doAppendConnector = NO;
+		for (NSUInteger i = 0; i < count; i++) {
+			conjunction = [conjunctions objectAtIndex: i];
+			if ([conjunctions indexOfObject: conjunction] < i) {
+				continue;
+			}
+			if (doAppendConnector) {
+				[sql appendCString: " OR "];
+			}
+			int j = 0;
+			for (ZIMSqlCondition *condition in conjunction) {
+				if (j > 0) {
+					[sql appendCString: " AND "];
+				}
+				if ([condition->_type isEqualToString: ZIMSqlConditionTypeGroup]) {
+					[sql appendBytes: "(" length: 1];
+					[condition appendToWriter: sql parameters: parameters temporaryTables: tables];
+					[sql appendBytes: ")" length: 1];
+				}
+				else {
+					[condition appendToWriter: sql parameters: parameters temporaryTables: tables];
+				}
+				j++;
+			}
+			doAppendConnector = YES;
+		}
+	}
+	else if ([_type isEqualToString: ZIMSqlConditionTypeColumn]) {
+		[sql appendString: (NSString *)_value];
+	}
+	else if ([_type isEqualToString: ZIMSqlConditionTypeLiteral]) {
+		[ZIMSqlExpression appendValue: _value toWriter: sql parameters: nil];
+	}
+	else if ([_type isEqualToString: ZIMSqlConditionTypeBind]) {
+		[ZIMSqlExpression appendValue: _value toWriter: sql parameters: parameters];
+	}
+	else if ([_type isEqualToString: ZIMSqlConditionTypeSubquery]) {
+		[ZIMSqlExpression appendValue: _value toWriter: sql parameters: parameters temporaryTables: tables];
+	}
+	else if ([_type isEqualToString: ZIMSqlConditionTypeList]) {
+		// Note: SQLite limits the number of placeholders in a statement, so a long list that can neither
+		// be staged nor read through "json_each" is rendered with literals.
+		NSMutableArray *values = ((parameters != nil) && ([_operands count] > ZIMSqlConditionInlineListLimit)) ? nil : parameters;
+		[sql appendCString: "("];
+		int i = 0;
+		for (ZIMSqlCondition *operand in _operands) {
+			if (i > 0) {
+				[sql appendCString: ", "];
+			}
+			[operand appendToWriter: sql parameters: values temporaryTables: tables];
+			i++;
+		}
+		[sql appendCString: ")"];
+	}
+	else {
+		ZIMSqlCondition *right = [_operands objectAtIndex: 1];
+		[[_operands objectAtIndex: 0] appendToWriter: sql parameters: parameters temporaryTables: tables];
+		[sql appendBytes: " " length: 1];
+		[sql appendString: _operator];
+		[sql appendBytes: " " length: 1];
+		if ([_type isEqualToString: ZIMSqlConditionTypeIn] && [right->_type isEqualToString: ZIMSqlConditionTypeList] && ([right->_operands count] > ZIMSqlConditionInlineListLimit)) {
+			NSArray *values = [right listValues];
+			if ((values != nil) && (parameters != nil) && (tables != nil) && (([values count] > ZIMSqlConditionStagedListLimit) || !ZIMSqlConditionSupportsJson())) {
+				NSNumber *slot = ZIMSqlConditionNextSlot();
+				[tables setObject: values forKey: slot];
+				[sql appendCString: "(SELECT value FROM temp.zim_in WHERE slot = "];
+				[ZIMSqlExpression appendValue: slot toWriter: sql parameters: parameters];
+				[sql appendCString: ")"];
+				return;
+			}
+			else if ((values != nil) && (parameters != nil) && ZIMSqlConditionSupportsJson() && ZIMSqlConditionIsJsonList(values)) {
+				NSData *json = [NSJSONSerialization dataWithJSONObject: values options: 0 error: NULL];
+				if (json != nil) {
+					NSString *array = [[NSString alloc] initWithData: json encoding: NSUTF8StringEncoding];
+					[sql appendCString: "(SELECT value FROM json_each("];
+					[ZIMSqlExpression appendValue: array toWriter: sql parameters: parameters];
+					[sql appendCString: "))"];
+					return;
+				}
+			}
+		}
+		[right appendToWriter: sql parameters: parameters temporaryTables: tables];
+		if ([_type isEqualToString: ZIMSqlConditionTypeBetween]) {
+			[sql appendCString: " AND "];
+			[[_operands objectAtIndex: 2] appendToWriter: sql parameters: parameters temporaryTables: tables];
+		}
+	}
+}
+
+- (BOOL) isEqual: (id)object {
+	if (object == self) {
+		return YES;
+	}
+	if (![object isKindOfClass: [ZIMSqlCondition class]]) {
+		return NO;
+	}
+	ZIMSqlCondition *condition = (ZIMSqlCondition *)object;
+	return [_type isEqualToString: condition->_type]
+		&& ((_operator == condition->_operator) || [_operator isEqualToString: condition->_operator])
+		&& ((_value == condition->_value) || [_value isEqual: condition->_value])
+		&& [_operands isEqualToArray: condition->_operands]
+		&& [_connectors isEqualToArray: condition->_connectors];
+}
+
+- (NSUInteger) hash {
+	return [_type hash] ^ [_operator hash] ^ [_value hash] ^ [_operands count];
+}
+
+- (id) copyWithZone: (NSZone *)zone {
+	if (![_type isEqualToString: ZIMSqlConditionTypeGroup]) {
+		return self; // i.e. leaf nodes are immutable
+	}
+	ZIMSqlCondition *group = [[ZIMSqlCondition allocWithZone: zone] initWithType: _type operator: nil value: nil operands: nil];
+	for (ZIMSqlCondition *condition in _operands) {
+		[group->_operands addObject: [condition copyWithZone: zone]];
+	}
+	[group->_connectors addObjectsFromArray: _connectors];
+	group->_open = _open;
+	return group;
+}
+
+- (NSString *) description {
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] init];
+	[self appendToWriter: sql parameters: nil];
+	return [sql string];
+}
+
+@end
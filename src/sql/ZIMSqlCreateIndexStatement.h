@@ -15,6 +15,7 @@
  */
 
 #import "ZIMSqlStatement.h"
+#import "ZIMSqlCondition.h"
 #import "ZIMSqlDataDefinitionCommand.h"
 
 /*!
@@ -29,9 +30,11 @@
 		NSString *_index;
 		NSString *_table;
 		BOOL _unique;
-		NSMutableSet *_column;
+		NSMutableArray *_column;
+		ZIMSqlCondition *_where;
 		NSMutableArray *_stack;
 		NSString *_cdata;
+		NSDictionary *_attributes;
 		NSInteger _counter;
 		NSError *_error;
 
@@ -78,27 +81,111 @@
 - (void) column: (NSString *)column;
 /*!
  @method				column:descending:
- @discussion			This method adds the specified column to be indexed.
+ @discussion			This method adds the specified column to be indexed.  Columns are indexed in the
+						order that they are added.
  @param column			The column to be indexed.
  @param descending		This will determine whether the column should be ordered in descending order.
- @updated				2011-10-30
+ @updated				2026-10-19
  */
 - (void) column: (NSString *)column descending: (BOOL)descending;
+/*!
+ @method				column:collate:descending:
+ @discussion			This method adds the specified column to be indexed with the specified collating
+						sequence.
+ @param column			The column to be indexed.
+ @param collation		The collating sequence to be used (e.g. ZIMSqlCollateNoCase).
+ @param descending		This will determine whether the column should be ordered in descending order.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/datatype3.html#collation
+ */
+- (void) column: (NSString *)column collate: (NSString *)collation descending: (BOOL)descending;
+/*!
+ @method				expression:collate:descending:
+ @discussion			This method adds the specified expression to be indexed (e.g. "lower(name)").
+						The expression may only refer to columns of the indexed table and deterministic
+						functions.
+ @param expression		The expression to be indexed.
+ @param collation		The collating sequence to be used (i.e. nil for the default).
+ @param descending		This will determine whether the expression should be ordered in descending order.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/expridx.html
+ */
+- (void) expression: (NSString *)expression collate: (NSString *)collation descending: (BOOL)descending;
 /*!
  @method				columns:
- @discussion			This method adds the specified columns to be indexed.
+ @discussion			This method adds the specified columns to be indexed.  Use an array when the
+						order of the columns matters.
  @param columns			The columns to be indexed.
- @updated				2011-07-28
+ @updated				2026-10-19
  */
-- (void) columns: (NSSet *)columns;
+- (void) columns: (id<NSFastEnumeration>)columns;
 /*!
- @method				column:descending:
- @discussion			This method adds the specified columns to be indexed.
+ @method				columns:descending:
+ @discussion			This method adds the specified columns to be indexed.  Use an array when the
+						order of the columns matters.
  @param columns			The columns to be indexed.
  @param descending		This will determine whether the column should be ordered in descending order.
- @updated				2011-07-28
+ @updated				2026-10-19
+ */
+- (void) columns: (id<NSFastEnumeration>)columns descending: (BOOL)descending;
+/*!
+ @method				whereBlock:
+ @discussion			This method will start or end a block in the partial index's predicate.
+ @param brace			The brace to be used; it is either an opening or closing brace.
+ @updated				2026-10-19
+ */
+- (void) whereBlock: (NSString *)brace;
+/*!
+ @method				whereBlock:connector:
+ @discussion			This method will start or end a block in the partial index's predicate.
+ @param brace			The brace to be used; it is either an opening or closing brace.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ */
+- (void) whereBlock: (NSString *)brace connector: (NSString *)connector;
+/*!
+ @method				where:operator:column:
+ @discussion			This method will add a where clause to the partial index's predicate.
+ @param column1			The column to be tested.
+ @param operator		The operator to be used.
+ @param column2			The column to be compared.
+ @updated				2026-10-19
+ */
+- (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2;
+/*!
+ @method				where:operator:column:connector:
+ @discussion			This method will add a where clause to the partial index's predicate.
+ @param column1			The column to be tested.
+ @param operator		The operator to be used.
+ @param column2			The column to be compared.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ */
+- (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector;
+/*!
+ @method				where:operator:value:
+ @discussion			This method will add a where clause to the partial index's predicate (e.g. so
+						that rows which have been soft deleted are not indexed).  Only the rows that
+						satisfy the predicate are indexed, and a query can only use the index when its
+						own where clause implies the predicate.
+ @param column			The column to be tested.
+ @param operator		The operator to be used.
+ @param value			The value to be compared; it is written as a literal.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/partialindex.html
+ */
+- (void) where: (NSString *)column operator: (NSString *)operator value: (id)value; // wrap primitives with NSNumber
+/*!
+ @method				where:operator:value:connector:
+ @discussion			This method will add a where clause to the partial index's predicate.
+ @param column			The column to be tested.
+ @param operator		The operator to be used.
+ @param value			The value to be compared; it is written as a literal.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/partialindex.html
  */
-- (void) columns: (NSSet *)columns descending: (BOOL)descending;
+- (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector; // wrap primitives with NSNumber
 /*!
  @method				statement
  @discussion			This method will return the SQL statement.
@@ -23,9 +23,11 @@
 		_unique = NO;
 		_index = nil;
 		_table = nil;
-		_column = [[NSMutableSet alloc] init];
+		_column = [[NSMutableArray alloc] init];
+		_where = [ZIMSqlCondition group];
         _stack = [[NSMutableArray alloc] init];
 		_cdata = nil;
+		_attributes = nil;
         _counter = 0;
         _error = *error;
         if (xml != nil) {
@@ -56,37 +58,95 @@
 }
 
 - (void) column: (NSString *)column descending: (BOOL)descending {
-	[_column addObject: [NSString stringWithFormat: @"%@ %@", [ZIMSqlExpression prepareIdentifier: column maxCount: 1], [ZIMSqlExpression prepareSortOrder: descending]]];
+	[self column: column collate: nil descending: descending];
 }
 
-- (void) columns: (NSSet *)columns {
+- (void) column: (NSString *)column collate: (NSString *)collation descending: (BOOL)descending {
+	NSString *term = (collation != nil)
+		? [NSString stringWithFormat: @"%@ COLLATE %@ %@", [ZIMSqlExpression prepareIdentifier: column maxCount: 1], [ZIMSqlExpression prepareCollation: collation], [ZIMSqlExpression prepareSortOrder: descending]]
+		: [NSString stringWithFormat: @"%@ %@", [ZIMSqlExpression prepareIdentifier: column maxCount: 1], [ZIMSqlExpression prepareSortOrder: descending]];
+	if (![_column containsObject: term]) {
+		[_column addObject: term];
+	}
+}
+
+- (void) expression: (NSString *)expression collate: (NSString *)collation descending: (BOOL)descending {
+	expression = [expression stringByTrimmingCharactersInSet: [NSCharacterSet characterSetWithCharactersInString: @" ;\n\r\t\f"]];
+	if ([expression length] == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid expression provided." userInfo: nil];
+	}
+	NSString *term = (collation != nil)
+		? [NSString stringWithFormat: @"(%@) COLLATE %@ %@", expression, [ZIMSqlExpression prepareCollation: collation], [ZIMSqlExpression prepareSortOrder: descending]]
+		: [NSString stringWithFormat: @"(%@) %@", expression, [ZIMSqlExpression prepareSortOrder: descending]];
+	if (![_column containsObject: term]) {
+		[_column addObject: term];
+	}
+}
+
+- (void) columns: (id<NSFastEnumeration>)columns {
     [self columns: columns descending: NO];
 }
 
-- (void) columns: (NSSet *)columns descending: (BOOL)descending {
+- (void) columns: (id<NSFastEnumeration>)columns descending: (BOOL)descending {
 	for (NSString *column in columns) {
 		[self column: column descending: descending];
 	}
 }
 
+- (void) whereBlock: (NSString *)brace {
+	[self whereBlock: brace connector: ZIMSqlConnectorAnd];
+}
+
+- (void) whereBlock: (NSString *)brace connector: (NSString *)connector {
+	[_where block: brace connector: connector];
+}
+
+- (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 {
+	[self where: column1 operator: operator column: column2 connector: ZIMSqlConnectorAnd];
+}
+
+- (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector {
+	[_where addCondition: [ZIMSqlCondition predicate: column1 operator: operator column: column2] connector: connector];
+}
+
+- (void) where: (NSString *)column operator: (NSString *)operator value: (id)value {
+	[self where: column operator: operator value: value connector: ZIMSqlConnectorAnd];
+}
+
+- (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector {
+	[_where addCondition: [ZIMSqlCondition predicate: column operator: operator value: value] connector: connector];
+}
+
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 64 + 32 * ([_column count] + [_where count])];
 
-	[sql appendString: @"CREATE"];
+	[sql appendCString: "CREATE"];
 
 	if (_unique) {
-		[sql appendString: @" UNIQUE"];
+		[sql appendCString: " UNIQUE"];
 	}
 
-	[sql appendFormat: @" INDEX %@ ON %@", _index, _table];
-	
+	[sql appendCString: " INDEX "];
+	[sql appendString: _index];
+	[sql appendCString: " ON "];
+	[sql appendString: _table];
+
 	if ([_column count] > 0) {
-		[sql appendFormat: @" (%@)", [[_column allObjects] componentsJoinedByString: @", "]];
+		[sql appendCString: " ("];
+		[sql appendStrings: _column separator: ", "];
+		[sql appendCString: ")"];
+	}
+
+	if (![_where isEmpty]) {
+		// Note: A partial index's predicate can neither contain bound parameters nor read from a table-valued
+		// function, so every value (even in a long "IN" list) is written inline as a literal.
+		[sql appendCString: " WHERE "];
+		[_where appendToWriter: sql parameters: nil temporaryTables: nil];
 	}
 
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
@@ -104,7 +164,29 @@
             NSString *name = [attributes objectForKey: @"name"];
             NSString *order = [attributes objectForKey: @"order"];
 			BOOL descending = ((order != nil) && [[order uppercaseString] isEqualToString: @"DESC"]);
-			[self column: name descending: descending];
+			[self column: name collate: [attributes objectForKey: @"collate"] descending: descending];
+        }
+        else if ([xpath isEqualToString: @"database/index/expression"]) {
+			_cdata = nil;
+			_attributes = attributes;
+        }
+        else if ([xpath isEqualToString: @"database/index/where"]) {
+			NSString *connector = [attributes objectForKey: @"connector"];
+			NSString *value = [attributes objectForKey: @"value"];
+			id literal = value;
+			if ((value == nil) || [[value uppercaseString] isEqualToString: @"NULL"]) {
+				literal = [NSNull null];
+			}
+			else {
+				NSScanner *scanner = [NSScanner scannerWithString: value];
+				double number;
+				if ([scanner scanDouble: &number] && [scanner isAtEnd]) {
+					literal = ([value rangeOfCharacterFromSet: [NSCharacterSet characterSetWithCharactersInString: @".eE"]].location == NSNotFound)
+						? [NSNumber numberWithLongLong: [value longLongValue]]
+						: [NSNumber numberWithDouble: number];
+				}
+			}
+			[self where: [attributes objectForKey: @"column"] operator: [attributes objectForKey: @"operator"] value: literal connector: (connector != nil) ? connector : ZIMSqlConnectorAnd];
         }
     }
 }
@@ -114,9 +196,19 @@
 	if ([xpath isEqualToString: @"database/index"]) {
 		_counter++;
 	}
+	else if ((_counter < 1) && [xpath isEqualToString: @"database/index/expression"]) {
+		NSString *order = [_attributes objectForKey: @"order"];
+		BOOL descending = ((order != nil) && [[order uppercaseString] isEqualToString: @"DESC"]);
+		[self expression: _cdata collate: [_attributes objectForKey: @"collate"] descending: descending];
+		_attributes = nil;
+	}
 	[_stack removeLastObject];
 }
 
+- (void) parser: (NSXMLParser *)parser foundCDATA: (NSData *)CDATABlock {
+	_cdata = [[NSString alloc] initWithData: CDATABlock encoding: NSUTF8StringEncoding];
+}
+
 - (void) parser: (NSXMLParser *)parser parseErrorOccurred: (NSError *)error {
     if (_error) {
         _error = error;
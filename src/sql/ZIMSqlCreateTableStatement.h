@@ -32,6 +32,8 @@
 		NSMutableArray *_columnArray;
 		NSString *_primaryKey;
 		NSString *_unique;
+		BOOL _withoutRowId;
+		BOOL _strict;
 		NSMutableArray *_stack;
 		NSInteger _counter;
 		NSError *_error;
@@ -107,6 +109,21 @@
  @updated				2011-10-30
  */
 - (void) column: (NSString *)column type: (NSString *)type unique: (BOOL)unique;
+/*!
+ @method				column:type:generatedAs:stored:
+ @discussion			This method will create a generated column whose value is computed from the
+						specified expression.  A generated column can be indexed like any other column
+						(e.g. to index a value extracted from a JSON document).
+ @param column			The column to be created.
+ @param type			The datatype of the column.
+ @param expression		The expression that computes the column's value; it may only refer to other
+						columns in the same row and deterministic functions.
+ @param stored			This determines whether the value is stored when the row is written (i.e. YES)
+						or computed when the row is read (i.e. NO).
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/gencol.html
+ */
+- (void) column: (NSString *)column type: (NSString *)type generatedAs: (NSString *)expression stored: (BOOL)stored;
 /*!
  @method				primaryKey:
  @discussion			This method will set the specified columns to be the (composite) primary key.
@@ -121,6 +138,28 @@
  @updated				2011-11-01
  */
 - (void) unique: (NSArray *)columns;
+/*!
+ @method				withoutRowId:
+ @discussion			This method establishes whether the table will be stored without a rowid.  The
+						rows of such a table are kept in its primary key's B-tree, so a table that is
+						keyed by a composite or text key needs neither a separate rowid B-tree nor an
+						index for its primary key.  The table must declare a primary key and cannot use
+						AUTOINCREMENT.
+ @param withoutRowId	Establishes whether the table will be stored without a rowid.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/withoutrowid.html
+ */
+- (void) withoutRowId: (BOOL)withoutRowId;
+/*!
+ @method				strict:
+ @discussion			This method establishes whether the table will enforce its column datatypes.  The
+						columns of a strict table must be declared as INT, INTEGER, REAL, TEXT, BLOB, or
+						ANY.  Requires SQLite 3.37.0 or later.
+ @param strict			Establishes whether the table will be strict.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/stricttables.html
+ */
+- (void) strict: (BOOL)strict;
 /*!
  @method				statement
  @discussion			This method will return the SQL statement.
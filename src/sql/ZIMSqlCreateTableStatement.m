@@ -26,6 +26,8 @@
 		_columnArray = [[NSMutableArray alloc] init];
 		_primaryKey = nil;
 		_unique = nil;
+		_withoutRowId = NO;
+		_strict = NO;
         _stack = [[NSMutableArray alloc] init];
         _counter = 0;
         _error = *error;
@@ -94,6 +96,21 @@
 	}
 }
 
+- (void) column: (NSString *)column type: (NSString *)type generatedAs: (NSString *)expression stored: (BOOL)stored {
+	if (ZIMSqlLibraryVersion() < 3031000) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Generated columns require SQLite 3.31.0 or later." userInfo: nil];
+	}
+	expression = [expression stringByTrimmingCharactersInSet: [NSCharacterSet characterSetWithCharactersInString: @" ;\n\r\t\f"]];
+	if ([expression length] == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Must provide an expression for generated column '%@'.", column] userInfo: nil];
+	}
+	column = [ZIMSqlExpression prepareIdentifier: column maxCount: 1];
+	if ([_columnDictionary objectForKey: column] == nil) {
+		[_columnArray addObject: column];
+	}
+	[_columnDictionary setObject: [NSString stringWithFormat: @"%@ %@ GENERATED ALWAYS AS (%@) %@", column, type, expression, (stored) ? @"STORED" : @"VIRTUAL"] forKey: column];
+}
+
 - (void) primaryKey: (NSArray *)columns {
 	if (columns != nil) {
 		NSMutableString *primaryKey = [[NSMutableString alloc] init];
@@ -140,39 +157,78 @@
 	}
 }
 
+- (void) withoutRowId: (BOOL)withoutRowId {
+	_withoutRowId = withoutRowId;
+}
+
+- (void) strict: (BOOL)strict {
+	if (strict && (ZIMSqlLibraryVersion() < 3037000)) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Strict tables require SQLite 3.37.0 or later." userInfo: nil];
+	}
+	_strict = strict;
+}
+
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	if (_withoutRowId) {
+		BOOL hasPrimaryKey = (_primaryKey != nil);
+		for (NSString *column in _columnArray) {
+			NSString *definition = [_columnDictionary objectForKey: column];
+			if ([definition rangeOfString: @" AUTOINCREMENT"].location != NSNotFound) {
+				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Column '%@' cannot be auto incremented in a table without a rowid.", column] userInfo: nil];
+			}
+			if ([definition hasSuffix: @" PRIMARY KEY"]) {
+				hasPrimaryKey = YES;
+			}
+		}
+		if (!hasPrimaryKey) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a primary key for a table without a rowid." userInfo: nil];
+		}
+	}
+
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 64 + 32 * [_columnArray count]];
 	
-	[sql appendString: @"CREATE"];
+	[sql appendCString: "CREATE"];
 
 	if (_temporary) {
-		[sql appendString: @" TEMPORARY"];
+		[sql appendCString: " TEMPORARY"];
 	}
 	
-	[sql appendFormat: @" TABLE %@ (", _table];
+	[sql appendCString: " TABLE "];
+	[sql appendString: _table];
+	[sql appendCString: " ("];
 
 	int i = 0;
 	for (NSString *column in _columnArray) {
 		if (i > 0) {
-			[sql appendFormat: @", %@", (NSString *)[_columnDictionary objectForKey: column]];
-		}
-		else {
-			[sql appendString: (NSString *)[_columnDictionary objectForKey: column]];
+			[sql appendCString: ", "];
 		}
+		[sql appendString: (NSString *)[_columnDictionary objectForKey: column]];
 		i++;
 	}
 
 	if (_primaryKey != nil) {
-		[sql appendFormat: @", %@", _primaryKey];
+		[sql appendCString: ", "];
+		[sql appendString: _primaryKey];
 	}
 
 	if (_unique != nil) {
-		[sql appendFormat: @", %@", _unique];
+		[sql appendCString: ", "];
+		[sql appendString: _unique];
+	}
+
+	[sql appendCString: ")"];
+
+	if (_withoutRowId) {
+		[sql appendCString: " WITHOUT ROWID"];
+	}
+
+	if (_strict) {
+		[sql appendCString: (_withoutRowId) ? ", STRICT" : " STRICT"];
 	}
 
-	[sql appendString: @");"];
+	[sql appendCString: ";"];
 	
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
@@ -188,6 +244,14 @@
 			else {
 				[self table: name];
 			}
+			NSString *withoutRowId = [attributes objectForKey: @"without-rowid"];
+			if ((withoutRowId != nil) && [[withoutRowId uppercaseString] boolValue]) {
+				[self withoutRowId: YES];
+			}
+			NSString *strict = [attributes objectForKey: @"strict"];
+			if ((strict != nil) && [[strict uppercaseString] boolValue]) {
+				[self strict: YES];
+			}
         }
         else if ([xpath isEqualToString: @"database/table/column"]) {
             NSString *columnName = [attributes objectForKey: @"name"];
@@ -207,7 +271,12 @@
                 }
             }
             NSString *columnValue = [attributes objectForKey: @"auto-increment"];
-            if ((columnValue != nil) && [[columnValue uppercaseString] boolValue]) {
+            NSString *columnExpression = [attributes objectForKey: @"generated"];
+            if (columnExpression != nil) {
+                NSString *columnStored = [attributes objectForKey: @"stored"];
+                [self column: columnName type: columnType generatedAs: columnExpression stored: ((columnStored != nil) && [[columnStored uppercaseString] boolValue])];
+            }
+            else if ((columnValue != nil) && [[columnValue uppercaseString] boolValue]) {
                 [self column: columnName type: columnType defaultValue: ZIMSqlDefaultValueIsAutoIncremented];
             }
             else {
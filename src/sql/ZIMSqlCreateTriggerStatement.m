@@ -143,25 +143,32 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 128 + 64 * [_sql count]];
 	
-	[sql appendString: @"CREATE"];
+	[sql appendCString: "CREATE"];
 
 	if (_temporary) {
-		[sql appendString: @" TEMPORARY"];
+		[sql appendCString: " TEMPORARY"];
 	}
 	
-	[sql appendFormat: @" TRIGGER %@ %@ %@", _trigger, _advice, _event];
+	[sql appendCString: " TRIGGER "];
+	[sql appendString: _trigger];
+	[sql appendCString: " "];
+	[sql appendString: _advice];
+	[sql appendCString: " "];
+	[sql appendString: _event];
 
-    [sql appendString: @" FOR EACH ROW"];
+    [sql appendCString: " FOR EACH ROW"];
 
     if ([_when count] > 0) {
 		BOOL doAppendConnector = NO;
-		[sql appendString: @" WHEN "];
+		[sql appendCString: " WHEN "];
 		for (NSArray *when in _when) {
 			NSString *whenClause = [when objectAtIndex: 1];
 			if (doAppendConnector && ![whenClause isEqualToString: ZIMSqlEnclosureClosingBrace]) {
-				[sql appendFormat: @" %@ ", [when objectAtIndex: 0]];
+				[sql appendCString: " "];
+				[sql appendString: [when objectAtIndex: 0]];
+				[sql appendCString: " "];
 			}
 			[sql appendString: whenClause];
 			doAppendConnector = (![whenClause isEqualToString: ZIMSqlEnclosureOpeningBrace]);
@@ -169,16 +176,18 @@
 	}
 
     if ([_sql count] > 0) {
-        [sql appendString: @" BEGIN"];
+        [sql appendCString: " BEGIN"];
         for (NSString *stmt in _sql) {
-            [sql appendFormat: @" %@;", stmt];
+            [sql appendCString: " "];
+            [sql appendString: stmt];
+            [sql appendCString: ";"];
         }
-        [sql appendString: @" END"];
+        [sql appendCString: " END"];
     }
 
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 	
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
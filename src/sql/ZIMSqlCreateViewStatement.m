@@ -55,21 +55,23 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32 + [_statement length]];
 
-	[sql appendString: @"CREATE "];
+	[sql appendCString: "CREATE "];
 
 	if (_temporary) {
-		[sql appendString: @"TEMPORARY "];
+		[sql appendCString: "TEMPORARY "];
 	}
 	
-	[sql appendFormat: @"VIEW %@ AS ", _view];
+	[sql appendCString: "VIEW "];
+	[sql appendString: _view];
+	[sql appendCString: " AS "];
 
 	[sql appendString: _statement];
 	
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
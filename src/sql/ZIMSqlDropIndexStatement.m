@@ -49,19 +49,19 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
 	
-	[sql appendString: @"DROP INDEX "];
+	[sql appendCString: "DROP INDEX "];
 	
 	if (_exists) {
-		[sql appendString: @"IF EXISTS "];
+		[sql appendCString: "IF EXISTS "];
 	}
 	
 	[sql appendString: _index];
 	
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 	
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
@@ -49,19 +49,19 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
 	
-	[sql appendString: @"DROP TABLE "];
+	[sql appendCString: "DROP TABLE "];
 	
 	if (_exists) {
-		[sql appendString: @"IF EXISTS "];
+		[sql appendCString: "IF EXISTS "];
 	}
 	
 	[sql appendString: _table];
-
-	[sql appendString: @";"];
 	
-	return sql;
+	[sql appendCString: ";"];
+	
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
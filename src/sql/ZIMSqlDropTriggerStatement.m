@@ -49,19 +49,19 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
 	
-	[sql appendString: @"DROP TRIGGER "];
+	[sql appendCString: "DROP TRIGGER "];
 	
 	if (_exists) {
-		[sql appendString: @"IF EXISTS "];
+		[sql appendCString: "IF EXISTS "];
 	}
 	
 	[sql appendString: _trigger];
 	
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 	
-	return sql;
+	return [sql string];
 }
 
 - (void) parser: (NSXMLParser *)parser didStartElement: (NSString *)element namespaceURI: (NSString *)namespaceURI qualifiedName: (NSString *)qualifiedName attributes: (NSDictionary *)attributes {
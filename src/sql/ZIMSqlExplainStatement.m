@@ -35,19 +35,19 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 16 + [_statement length]];
 
-	[sql appendString: @"EXPLAIN "];
+	[sql appendCString: "EXPLAIN "];
 	
 	if (_level > 0) {
-		[sql appendString: @"QUERY PLAN "];
+		[sql appendCString: "QUERY PLAN "];
 	}
 
 	[sql appendString: _statement];
 	
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 
-	return sql;
+	return [sql string];
 }
 
 @end
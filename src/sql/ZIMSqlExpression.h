@@ -15,11 +15,17 @@
  */
 
 #import <Foundation/Foundation.h>
+#import "ZIMSqlWriter.h"
 
 // Block Statement Tokens
 #define ZIMSqlEnclosureOpeningBrace				@"("
 #define ZIMSqlEnclosureClosingBrace				@")"
 
+// Collating Sequences -- http://www.sqlite.org/datatype3.html#collation
+#define ZIMSqlCollateBinary						@"BINARY"
+#define ZIMSqlCollateNoCase						@"NOCASE"
+#define ZIMSqlCollateRTrim						@"RTRIM"
+
 // Connectors
 #define ZIMSqlConnectorAnd						@"AND"
 #define ZIMSqlConnectorOr						@"OR"
@@ -83,6 +89,33 @@
 #define ZIMSqlOperatorUnion						@"UNION"
 #define ZIMSqlOperatorUnionAll					@"UNION ALL"
 
+// Aggregate Functions -- http://www.sqlite.org/lang_aggfunc.html
+#define ZIMSqlFunctionAvg						@"AVG"
+#define ZIMSqlFunctionCount						@"COUNT"
+#define ZIMSqlFunctionGroupConcat				@"GROUP_CONCAT"
+#define ZIMSqlFunctionMax						@"MAX"
+#define ZIMSqlFunctionMin						@"MIN"
+#define ZIMSqlFunctionSum						@"SUM"
+#define ZIMSqlFunctionTotal						@"TOTAL"
+
+// Window Functions -- http://www.sqlite.org/windowfunctions.html#builtins
+#define ZIMSqlFunctionRowNumber					@"ROW_NUMBER"
+#define ZIMSqlFunctionRank						@"RANK"
+#define ZIMSqlFunctionDenseRank					@"DENSE_RANK"
+#define ZIMSqlFunctionPercentRank				@"PERCENT_RANK"
+#define ZIMSqlFunctionCumeDist					@"CUME_DIST"
+#define ZIMSqlFunctionNtile						@"NTILE"
+#define ZIMSqlFunctionLag						@"LAG"
+#define ZIMSqlFunctionLead						@"LEAD"
+#define ZIMSqlFunctionFirstValue				@"FIRST_VALUE"
+#define ZIMSqlFunctionLastValue					@"LAST_VALUE"
+#define ZIMSqlFunctionNthValue					@"NTH_VALUE"
+
+// Window Frames -- http://www.sqlite.org/windowfunctions.html#frame_specifications
+#define ZIMSqlWindowFrameDefault				@"RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW"
+#define ZIMSqlWindowFrameRunning				@"ROWS BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW"
+#define ZIMSqlWindowFrameEntire					@"ROWS BETWEEN UNBOUNDED PRECEDING AND UNBOUNDED FOLLOWING"
+
 // Show Types
 #define ZIMSqlShowTypeAll						@"ALL"
 #define ZIMSqlShowTypePermanent					@"PERMANENT"
@@ -134,6 +167,9 @@ NSString *ZIMSqlDataTypeNVarChar(NSInteger x);
 NSString *ZIMSqlDataTypeVarChar(NSInteger x);
 NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
 
+// Library Version -- http://www.sqlite.org/c3ref/libversion.html
+int ZIMSqlLibraryVersion(void); // e.g. 3035000 for SQLite 3.35.0
+
 /*!
  @class					ZIMSqlExpression
  @discussion			This class contains a set of methods to help process input.
@@ -142,12 +178,23 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
 @interface ZIMSqlExpression : NSObject {
 
 }
+/*!
+ @method				prepareCollation:
+ @discussion			This method will prepare the name of a collating sequence for an SQL statement.
+						Any name that is a valid bare identifier is accepted so that collating sequences
+						registered with sqlite3_create_collation() can be used.
+ @param collation		The name of the collating sequence to be prepared.
+ @return				The prepared name.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/create_collation.html
+ */
++ (NSString *) prepareCollation: (NSString *)collation;
 /*!
  @method				prepareConnector:
  @discussion			This method will prepare a connector for an SQL statement.
  @param token			The token to be prepared.
  @return				The prepared token.
- @updated				2011-10-29
+ @updated				2026-10-19
  */
 + (NSString *) prepareConnector: (NSString *)token;
 /*!
@@ -158,21 +205,31 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
  @updated				2011-06-25
  */
 + (NSString *) prepareEnclosure: (NSString *)token;
+/*!
+ @method				prepareFunction:
+ @discussion			This method will prepare the name of an aggregate or window function for an SQL
+						statement.
+ @param function		The name of the function to be prepared.
+ @return				The prepared function name.
+ @updated				2026-10-19
+ */
++ (NSString *) prepareFunction: (NSString *)function;
 /*!
  @method				prepareIdentifier:
  @discussion			This method will prepare an identifier for an SQL statement.
  @param identifier		The token to be prepared.
  @return				The prepared token.
- @updated				2011-11-01
+ @updated				2026-10-19
  */
 + (NSString *) prepareIdentifier: (NSString *)identifier;
 /*!
  @method				prepareIdentifier:maxCount:
- @discussion			This method will prepare an identifier for an SQL statement.
+ @discussion			This method will prepare an identifier for an SQL statement.  Identifiers with
+						one or two segments are cached once prepared.
  @param identifier		The identifier to be prepared.
  @param count			The maximum number of segments that the reference may have.
  @return				The prepared reference identifier.
- @updated				2011-11-03
+ @updated				2026-10-19
  */
 + (NSString *) prepareIdentifier: (NSString *)identifier maxCount: (NSUInteger)count;
 /*!
@@ -180,7 +237,7 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
  @discussion			This method will prepare a join type token for an SQL statement.
  @param token			The token to be prepared.
  @return				The prepared token.
- @updated				2011-11-03
+ @updated				2026-10-19
  */
 + (NSString *) prepareJoinType: (NSString *)token;
 /*!
@@ -197,9 +254,18 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
  @param operator		The operator to be prepared.
  @param type			The type of operator.
  @return				The prepared operator.
- @updated				2011-11-03
+ @updated				2026-10-19
  */
 + (NSString *) prepareOperator: (NSString *)operator ofType: (NSString *)type;
+/*!
+ @method				prepareReturning:
+ @discussion			This method will prepare a column for the "RETURNING" clause of an SQL statement.
+ @param column			The column to be returned or "*" for every column.
+ @return				The prepared column.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_returning.html
+ */
++ (NSString *) prepareReturning: (NSString *)column;
 /*!
  @method				prepareSortOrder:
  @discussion			This method will prepare a sort order token for an SQL statement.
@@ -214,19 +280,68 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x);
  @discussion			This method will prepare the sort weight for an SQL statement.
  @param weight			This indicates how nulls are to be weighed when comparing with non-nulls.
  @return				The prepared sort weight.
- @updated				2011-11-06
+ @updated				2026-10-19
  */
 + (NSString *) prepareSortWeight: (NSString *)weight;
+/*!
+ @method				prepareWindowFrame:
+ @discussion			This method will prepare a window's frame specification for an SQL statement.  The
+						frame may only consist of frame keywords and unsigned integer offsets.
+ @param frame			The frame specification to be prepared (e.g. "ROWS BETWEEN 2 PRECEDING AND CURRENT ROW").
+ @return				The prepared frame specification.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/windowfunctions.html#frame_specifications
+ */
++ (NSString *) prepareWindowFrame: (NSString *)frame;
 /*!
  @method				prepareValue:
- @discussion			This method will prepare a value for an SQL statement.
+ @discussion			This method will prepare a value for an SQL statement.  Data is encoded as a blob
+						literal (i.e. X'...'); to avoid encoding it altogether, bind it as a parameter.
  @param value			The value to be prepared.
  @return				The prepared value.
- @updated				2011-10-19
+ @updated				2026-10-19
  @see					http://www.sqlite.org/c3ref/mprintf.html
  @see					http://codingrecipes.com/objective-c-a-function-for-escaping-values-before-inserting-into-sqlite
  @see					http://wiki.sa-mp.com/wiki/Escaping_Strings_SQLite
  */
 + (NSString *) prepareValue: (id)value;
+/*!
+ @method				prepareValue:parameters:
+ @discussion			This method will prepare a value for an SQL statement.  When a parameters array is
+						provided, the value is appended to the array and a "?" placeholder is returned in
+						its place; otherwise, the value is escaped as a literal.
+ @param value			The value to be prepared.
+ @param parameters		The array to which the bound values will be appended. May be nil.
+ @return				The prepared value or placeholder.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_expr.html#varparam
+ */
++ (NSString *) prepareValue: (id)value parameters: (NSMutableArray *)parameters;
+/*!
+ @method				appendValue:toWriter:parameters:
+ @discussion			This method will prepare a value and will append it directly to the SQL statement
+						without creating an intermediate string.  Strings are escaped in a single pass, while
+						numbers are formatted without a format string.
+ @param value			The value to be prepared.
+ @param sql				The writer to which the prepared value will be appended.
+ @param parameters		The array to which the bound values will be appended.  When nil, the value is
+						rendered as a literal.
+ @updated				2026-10-19
+ */
++ (void) appendValue: (id)value toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters;
+/*!
+ @method				appendValue:toWriter:parameters:temporaryTables:
+ @discussion			This method will prepare a value and will append it directly to the SQL statement.  When
+						the value is a select statement, the values of any "IN" list it has staged are added
+						to the specified dictionary so that they can be staged along with the outer statement.
+ @param value			The value to be prepared.
+ @param sql				The writer to which the prepared value will be appended.
+ @param parameters		The array to which the bound values will be appended.  When nil, the value is
+						rendered as a literal.
+ @param tables			The dictionary to which the values of any staged list will be added, keyed by
+						its slot.  May be nil.
+ @updated				2026-10-19
+ */
++ (void) appendValue: (id)value toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables;
 
 @end
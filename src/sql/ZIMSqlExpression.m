@@ -15,44 +15,34 @@
  */
 
 #import <sqlite3.h> // Requires libsqlite3.dylib
-#import "NSString+ZIMString.h"
 #import "ZIMSqlExpression.h"
 #import "ZIMSqlSelectStatement.h"
+#import "ZIMSqlWriter.h"
 
 NSString *ZIMSqlDefaultValue(id value) {
 	if ((value == nil) || [value isKindOfClass: [NSNull class]]) {
 		return @"DEFAULT NULL";
 	}
-	else if ([value isKindOfClass: [NSNumber class]]) {
-		return [NSString stringWithFormat: @"DEFAULT %@", value];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
+	[sql appendCString: "DEFAULT "];
+	if ([value isKindOfClass: [NSNumber class]]) {
+		[sql appendNumber: (NSNumber *)value];
 	}
 	else if ([value isKindOfClass: [NSString class]]) {
-		char *escapedValue = sqlite3_mprintf("DEFAULT '%q'", [(NSString *)value UTF8String]);
-		NSString *string = [NSString stringWithUTF8String: (const char *)escapedValue];
-		sqlite3_free(escapedValue);
-		return string;
+		[sql appendQuotedString: (NSString *)value];
 	}
 	else if ([value isKindOfClass: [NSData class]]) {
-		NSData *data = (NSData *)value;
-		int length = [data length];
-		NSMutableString *buffer = [[NSMutableString alloc] init];
-		[buffer appendString: @"DEFAULT '"];
-		const unsigned char *dataBuffer = [data bytes];
-		for (int i = 0; i < length; i++) {
-			[buffer appendFormat: @"%02x", (unsigned long)dataBuffer[i]];
-		}
-		[buffer appendString: @"'"];
-		return buffer;
+		[sql appendBlob: (NSData *)value];
 	}
 	else if ([value isKindOfClass: [NSDate class]]) {
 		NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
 		[formatter setDateFormat: @"yyyy-MM-dd HH:mm:ss"];
-		NSString *date = [NSString stringWithFormat: @"DEFAULT '%@'", [formatter stringFromDate: (NSDate *)value]];
-		return date;
+		[sql appendQuotedString: [formatter stringFromDate: (NSDate *)value]];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Unable to set default value. '%@'", value] userInfo: nil];
 	}
+	return [sql string];
 }
 
 NSString *ZIMSqlDataTypeChar(NSInteger x) {
@@ -87,13 +77,80 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x) {
 	return [NSString stringWithFormat: @"VARYING CHARACTER(%d)", x];
 }
 
+int ZIMSqlLibraryVersion(void) {
+	static int version = 0;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		version = sqlite3_libversion_number();
+	});
+	return version;
+}
+
+// Lookup tables for the tokens accepted by the prepare methods (i.e. in canonical form)
+static NSString *const ZIMSqlConnectors[] = { ZIMSqlConnectorAnd, ZIMSqlConnectorOr };
+static NSString *const ZIMSqlJoinTypes[] = { ZIMSqlJoinTypeCross, ZIMSqlJoinTypeInner, ZIMSqlJoinTypeLeft, ZIMSqlJoinTypeLeftOuter, ZIMSqlJoinTypeNatural, ZIMSqlJoinTypeNaturalCross, ZIMSqlJoinTypeNaturalInner, ZIMSqlJoinTypeNaturalLeft, ZIMSqlJoinTypeNaturalLeftOuter };
+static NSString *const ZIMSqlSetOperators[] = { ZIMSqlOperatorExcept, ZIMSqlOperatorIntersect, ZIMSqlOperatorUnion, ZIMSqlOperatorUnionAll };
+static NSString *const ZIMSqlSortWeights[] = { ZIMSqlNullsFirst, ZIMSqlNullsLast };
+static NSString *const ZIMSqlFunctions[] = { ZIMSqlFunctionAvg, ZIMSqlFunctionCount, ZIMSqlFunctionGroupConcat, ZIMSqlFunctionMax, ZIMSqlFunctionMin, ZIMSqlFunctionSum, ZIMSqlFunctionTotal, ZIMSqlFunctionRowNumber, ZIMSqlFunctionRank, ZIMSqlFunctionDenseRank, ZIMSqlFunctionPercentRank, ZIMSqlFunctionCumeDist, ZIMSqlFunctionNtile, ZIMSqlFunctionLag, ZIMSqlFunctionLead, ZIMSqlFunctionFirstValue, ZIMSqlFunctionLastValue, ZIMSqlFunctionNthValue };
+static NSString *const ZIMSqlFrameKeywords[] = { @"ROWS", @"RANGE", @"GROUPS", @"BETWEEN", @"AND", @"UNBOUNDED", @"PRECEDING", @"FOLLOWING", @"CURRENT", @"ROW", @"EXCLUDE", @"NO", @"OTHERS", @"GROUP", @"TIES" };
+
+#define ZIMSqlLookup(token, table) ZIMSqlLookupToken(token, table, sizeof(table) / sizeof(table[0]))
+
+/*!
+ @function				ZIMSqlLookupToken
+ @discussion			This function will find the canonical form of the token in the lookup table
+						without regard to case.
+ @param token			The token to be found.
+ @param table			The lookup table to be searched.
+ @param count			The number of entries in the lookup table.
+ @return				The canonical form of the token or nil if the token is not in the table.
+ @updated				2026-10-19
+ */
+static NSString *ZIMSqlLookupToken(NSString *token, NSString *const *table, NSUInteger count) {
+	if (token != nil) {
+		NSUInteger length = [token length];
+		for (NSUInteger i = 0; i < count; i++) {
+			if (([table[i] length] == length) && ([token caseInsensitiveCompare: table[i]] == NSOrderedSame)) {
+				return table[i];
+			}
+		}
+	}
+	return nil;
+}
+
 @implementation ZIMSqlExpression
 
+static NSCache *_identifiers[3];
+
++ (void) initialize {
+	if (self == [ZIMSqlExpression class]) {
+		for (int i = 1; i < 3; i++) { // caches identifiers with either 1 or 2 segments
+			_identifiers[i] = [[NSCache alloc] init];
+			[_identifiers[i] setCountLimit: 1024];
+		}
+	}
+}
+
++ (NSString *) prepareCollation: (NSString *)collation {
+	NSUInteger length = [collation length];
+	if (length == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid collation name provided." userInfo: nil];
+	}
+	for (NSUInteger i = 0; i < length; i++) {
+		unichar ch = [collation characterAtIndex: i];
+		if (!(((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || (ch == '_') || ((i > 0) && (ch >= '0') && (ch <= '9')))) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Invalid collation name '%@' provided.", collation] userInfo: nil];
+		}
+	}
+	return [collation uppercaseString];
+}
+
 + (NSString *) prepareConnector: (NSString *)token {
-	if (![token matchRegex: @"^(and|or)$" options: NSRegularExpressionCaseInsensitive]) {
+	NSString *connector = ZIMSqlLookup(token, ZIMSqlConnectors);
+	if (connector == nil) {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid connector token provided." userInfo: nil];
 	}
-	return [token uppercaseString];
+	return connector;
 }
 
 + (NSString *) prepareEnclosure: (NSString *)token {
@@ -103,8 +160,16 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x) {
 	return token;
 }
 
++ (NSString *) prepareFunction: (NSString *)function {
+	NSString *name = ZIMSqlLookup(function, ZIMSqlFunctions);
+	if (name == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Invalid function name '%@' provided.", function] userInfo: nil];
+	}
+	return name;
+}
+
 + (NSString *) prepareIdentifier: (NSString *)identifier {
-	if ([identifier matchRegex: @"^select .+$" options: NSRegularExpressionCaseInsensitive]) {
+	if (([identifier length] > 7) && ([identifier compare: @"select " options: NSCaseInsensitiveSearch range: NSMakeRange(0, 7)] == NSOrderedSame)) {
 		identifier = [identifier stringByTrimmingCharactersInSet: [NSCharacterSet characterSetWithCharactersInString: @" ;()\n\r\t\f"]];
 		identifier = [NSString stringWithFormat: @"(%@)", identifier];
 	}
@@ -112,35 +177,79 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x) {
 }
 
 + (NSString *) prepareIdentifier: (NSString *)identifier maxCount: (NSUInteger)count {
-	NSMutableString *buffer = [[NSMutableString alloc] init];
-	NSArray *tokens = [identifier componentsSeparatedByString: @"."];
-	int length = [tokens count];
-	int start = length - MIN(count, length);
-	NSError *error;
-	NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern: @"[^a-z0-9_ ]" options: NSRegularExpressionCaseInsensitive error: &error];
-	for (int index = start; index < length; index++) {
-		NSString *token = [tokens objectAtIndex: index];
-		token = [regex stringByReplacingMatchesInString: token options: 0 range: NSMakeRange(0, [token length]) withTemplate: @""];
-		token = [token stringByTrimmingCharactersInSet: [NSCharacterSet whitespaceAndNewlineCharacterSet]];
-		if (index > start) {
-			[buffer appendString: @"."];
+	NSCache *cache = ((identifier != nil) && (count < 3)) ? _identifiers[count] : nil;
+	NSString *prepared = [cache objectForKey: identifier];
+	if (prepared != nil) {
+		return prepared;
+	}
+
+	NSUInteger length = [identifier length];
+	unichar stack[130]; // i.e. enough for an identifier of up to 32 characters and its output
+	unichar *chars = (length <= 32) ? stack : (unichar *)malloc(sizeof(unichar) * (length * 4 + 2));
+	unichar *buffer = chars + length;
+	[identifier getCharacters: chars range: NSMakeRange(0, length)];
+
+	// Finds where the last "count" segments begin
+	NSUInteger begin = length;
+	NSUInteger segments = 0;
+	while (begin > 0) {
+		if (chars[begin - 1] == '.') {
+			segments++;
+			if (segments >= count) {
+				break;
+			}
+		}
+		begin--;
+	}
+
+	// Removes any invalid characters from each segment and then encloses the segment in brackets
+	NSUInteger size = 0;
+	if (count > 0) {
+		buffer[size++] = '[';
+		NSUInteger start = size;
+		for (NSUInteger i = begin; i <= length; i++) {
+			if ((i == length) || (chars[i] == '.')) {
+				while ((size > start) && (buffer[size - 1] == ' ')) {
+					size--;
+				}
+				buffer[size++] = ']';
+				if (i < length) {
+					buffer[size++] = '.';
+					buffer[size++] = '[';
+					start = size;
+				}
+			}
+			else {
+				unichar ch = chars[i];
+				if (((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || ((ch >= '0') && (ch <= '9')) || (ch == '_') || ((ch == ' ') && (size > start))) {
+					buffer[size++] = ch;
+				}
+			}
 		}
-		[buffer appendFormat: @"[%@]", token];
 	}
-	return buffer;
+
+	prepared = [NSString stringWithCharacters: buffer length: size];
+	if (chars != stack) {
+		free(chars);
+	}
+	if (cache != nil) {
+		[cache setObject: prepared forKey: [identifier copy]];
+	}
+	return prepared;
 }
 
 + (NSString *) prepareJoinType: (NSString *)token {
 	if ((token == nil) || [token isEqualToString: ZIMSqlJoinTypeNone]) {
-		token = ZIMSqlJoinTypeInner;
+		return ZIMSqlJoinTypeInner;
 	}
 	else if ([token isEqualToString: @","]) {
-		token = ZIMSqlJoinTypeCross;
+		return ZIMSqlJoinTypeCross;
 	}
-	if (![token matchRegex: @"^((natural )?(cross|inner|(left( outer)?)))|(natural)$" options: NSRegularExpressionCaseInsensitive]) {
+	NSString *joinType = ZIMSqlLookup(token, ZIMSqlJoinTypes);
+	if (joinType == nil) {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid join type token provided." userInfo: nil];
 	}
-	return [token uppercaseString];
+	return joinType;
 }
 
 + (NSInteger) prepareNaturalNumber: (NSInteger)number {
@@ -148,74 +257,125 @@ NSString *ZIMSqlDataTypeVaryingCharacter(NSInteger x) {
 }
 
 + (NSString *) prepareOperator: (NSString *)operator ofType: (NSString *)type {
-	if ([[type uppercaseString] isEqualToString: @"SET"] && ![operator matchRegex: @"^(except|intersect|(union( all)?))$" options: NSRegularExpressionCaseInsensitive]) {
-		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid set operator token provided." userInfo: nil];
+	if ([type caseInsensitiveCompare: @"SET"] == NSOrderedSame) {
+		NSString *setOperator = ZIMSqlLookup(operator, ZIMSqlSetOperators);
+		if (setOperator == nil) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid set operator token provided." userInfo: nil];
+		}
+		return setOperator;
 	}
 	return [operator uppercaseString];
 }
 
++ (NSString *) prepareReturning: (NSString *)column {
+	if (ZIMSqlLibraryVersion() < 3035000) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"The returning clause requires SQLite 3.35.0 or later." userInfo: nil];
+	}
+	if ([column isEqualToString: @"*"]) {
+		return column;
+	}
+	return [ZIMSqlExpression prepareIdentifier: column maxCount: 1];
+}
+
 + (NSString *) prepareSortOrder: (BOOL)descending {
 	return (descending) ? @"DESC" : @"ASC";
 }
 
 + (NSString *) prepareSortWeight: (NSString *)weight {
 	if (weight != nil) {
-		if (![weight matchRegex: @"^(first|last)$" options: NSRegularExpressionCaseInsensitive]) {
+		NSString *sortWeight = ZIMSqlLookup(weight, ZIMSqlSortWeights);
+		if (sortWeight == nil) {
 			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid weight token provided." userInfo: nil];
 		}
-		return [weight uppercaseString];
+		return sortWeight;
 	}
 	return @"DEFAULT";
 }
 
++ (NSString *) prepareWindowFrame: (NSString *)frame {
+	NSMutableArray *tokens = [[NSMutableArray alloc] init];
+	for (NSString *token in [frame componentsSeparatedByCharactersInSet: [NSCharacterSet whitespaceAndNewlineCharacterSet]]) {
+		if ([token length] == 0) {
+			continue;
+		}
+		NSString *keyword = ZIMSqlLookup(token, ZIMSqlFrameKeywords);
+		if (keyword != nil) {
+			[tokens addObject: keyword];
+		}
+		else if ([token rangeOfCharacterFromSet: [[NSCharacterSet characterSetWithCharactersInString: @"0123456789"] invertedSet]].location == NSNotFound) {
+			[tokens addObject: token];
+		}
+		else {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Invalid frame token '%@' provided.", token] userInfo: nil];
+		}
+	}
+	if ([tokens count] == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Invalid frame specification provided." userInfo: nil];
+	}
+	return [tokens componentsJoinedByString: @" "];
+}
+
 + (NSString *) prepareValue: (id)value {
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
+	[self appendValue: value toWriter: sql parameters: nil];
+	return [sql string];
+}
+
++ (NSString *) prepareValue: (id)value parameters: (NSMutableArray *)parameters {
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 32];
+	[self appendValue: value toWriter: sql parameters: parameters];
+	return [sql string];
+}
+
++ (void) appendValue: (id)value toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters {
+	[self appendValue: value toWriter: sql parameters: parameters temporaryTables: nil];
+}
+
++ (void) appendValue: (id)value toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables {
 	if ((value == nil) || [value isKindOfClass: [NSNull class]]) {
-		return @"NULL";
+		[sql appendBytes: "NULL" length: 4];
 	}
 	else if ([value isKindOfClass: [ZIMSqlSelectStatement class]]) {
-		NSString *statement = [(ZIMSqlSelectStatement *)value statement];
-		statement = [statement substringWithRange: NSMakeRange(0, [statement length] - 1)];
-		statement = [NSString stringWithFormat: @"(%@)", statement];
-		return statement;
+		NSString *statement = (parameters != nil) ? [(ZIMSqlSelectStatement *)value parameterizedStatement] : [(ZIMSqlSelectStatement *)value statement];
+		[sql appendBytes: "(" length: 1];
+		[sql appendString: [statement substringToIndex: [statement length] - 1]];
+		[sql appendBytes: ")" length: 1];
+		if (parameters != nil) {
+			[parameters addObjectsFromArray: [(ZIMSqlSelectStatement *)value parameters]];
+			if (tables != nil) { // i.e. a staged list in the subquery refers to a slot that the outer statement must stage
+				[tables addEntriesFromDictionary: [(ZIMSqlSelectStatement *)value temporaryTables]];
+			}
+		}
 	}
 	else if ([value isKindOfClass: [NSArray class]]) {
-		NSMutableString *str = [[NSMutableString alloc] init];
-		[str appendString: @"("];
-		for (int i = 0; i < [value count]; i++) {
+		[sql appendBytes: "(" length: 1];
+		int i = 0;
+		for (id element in (NSArray *)value) {
 			if (i > 0) {
-				[str appendString: @", "];
+				[sql appendBytes: ", " length: 2];
 			}
-			[str appendString: [self prepareValue: [value objectAtIndex: i]]];
+			[self appendValue: element toWriter: sql parameters: parameters temporaryTables: tables];
+			i++;
 		}
-		[str appendString: @")"];
-		return str;
+		[sql appendBytes: ")" length: 1];
+	}
+	else if ((parameters != nil) && ([value isKindOfClass: [NSNumber class]] || [value isKindOfClass: [NSString class]] || [value isKindOfClass: [NSData class]] || [value isKindOfClass: [NSDate class]])) {
+		[parameters addObject: value];
+		[sql appendBytes: "?" length: 1];
 	}
 	else if ([value isKindOfClass: [NSNumber class]]) {
-		return [NSString stringWithFormat: @"%@", value];
+		[sql appendNumber: (NSNumber *)value];
 	}
 	else if ([value isKindOfClass: [NSString class]]) {
-		char *escapedValue = sqlite3_mprintf("'%q'", [(NSString *)value UTF8String]);
-		NSString *string = [NSString stringWithUTF8String: (const char *)escapedValue];
-		sqlite3_free(escapedValue);
-		return string;
+		[sql appendQuotedString: (NSString *)value];
 	}
 	else if ([value isKindOfClass: [NSData class]]) {
-		NSData *data = (NSData *)value;
-		int length = [data length];
-		NSMutableString *buffer = [[NSMutableString alloc] init];
-		[buffer appendString: @"'"];
-		const unsigned char *dataBuffer = [data bytes];
-		for (int i = 0; i < length; i++) {
-			[buffer appendFormat: @"%02x", (unsigned long)dataBuffer[i]];
-		}
-		[buffer appendString: @"'"];
-		return buffer;
+		[sql appendBlob: (NSData *)value];
 	}
 	else if ([value isKindOfClass: [NSDate class]]) {
 		NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
 		[formatter setDateFormat: @"yyyy-MM-dd HH:mm:ss"];
-		NSString *date = [NSString stringWithFormat: @"'%@'", [formatter stringFromDate: (NSDate *)value]];
-		return date;
+		[sql appendQuotedString: [formatter stringFromDate: (NSDate *)value]];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Unable to prepare value. '%@'", value] userInfo: nil];
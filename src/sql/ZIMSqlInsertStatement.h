@@ -15,6 +15,7 @@
  */
 
 #import "ZIMSqlStatement.h"
+#import "ZIMSqlParameterizedStatement.h"
 #import "ZIMSqlDataManipulationCommand.h"
 
 /*!
@@ -23,11 +24,17 @@
  @updated				2011-07-15
  @see					http://www.sqlite.org/lang_insert.html
  */
-@interface ZIMSqlInsertStatement : NSObject <ZIMSqlStatement, ZIMSqlDataManipulationCommand> {
+@interface ZIMSqlInsertStatement : NSObject <ZIMSqlStatement, ZIMSqlParameterizedStatement, ZIMSqlDataManipulationCommand> {
 
 	@protected
 		NSString *_table;
 		NSMutableDictionary *_column;
+		NSMutableArray *_rows;
+		NSString *_statement;
+		NSString *_parameterizedStatement;
+		NSArray *_parameters;
+		NSMutableArray *_returning;
+		NSMutableDictionary *_temporaryTables;
 
 }
 /*!
@@ -45,12 +52,72 @@
  @updated				2011-10-30
  */
 - (void) column: (NSString *)column value: (id)value;
+/*!
+ @method				row:
+ @discussion			This method will add a row of column/value pairs to the SQL statement so that several
+						rows are inserted by a single statement.  Every row must declare the same columns, and
+						any pairs declared via column:value: form the first row.  Because SQLite limits the
+						number of placeholders in a statement, bulk inserts should be split into chunks.
+ @param values			The column/value pairs to be inserted.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/limits.html#max_variable_number
+ */
+- (void) row: (NSDictionary *)values;
+/*!
+ @method				appendRows:columns:toWriter:parameters:temporaryTables:
+ @discussion			This method will append the rows of a "VALUES" clause to the SQL statement.
+ @param rows			The rows to be appended.
+ @param columns			The columns in the order that their values are to be appended.
+ @param sql				The writer to which the rows will be appended.
+ @param parameters		The array to which the bound values will be appended.  When nil, the values
+						will be rendered as literals.
+ @param tables			The dictionary to which the values of any list staged by a subquery will be added,
+						keyed by its slot.  May be nil.
+ @updated				2026-10-19
+ */
++ (void) appendRows: (NSArray *)rows columns: (NSArray *)columns toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables;
+/*!
+ @method				returning:
+ @discussion			This method will add a column to the "RETURNING" clause of the SQL statement so that
+						the inserted rows are returned by the statement itself (see ZIMDbConnection's
+						execute:withParameters:returningAsObject:).  Requires SQLite 3.35.0 or later.
+ @param column			The column to be returned or "*" for every column.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_returning.html
+ */
+- (void) returning: (NSString *)column;
 /*!
  @method				statement
- @discussion			This method will return the SQL statement.
+ @discussion			This method will return the SQL statement.  The statement is only rebuilt
+						after the builder has been modified; otherwise, the cached statement is returned.
  @return				The SQL statement that was constructed.
- @updated				2011-10-19
+ @updated				2026-10-19
  */
 - (NSString *) statement;
+/*!
+ @method				parameterizedStatement
+ @discussion			This method will return the SQL statement with "?" placeholders in place of its
+						values.  Like the statement method, it is only rebuilt after the builder has been
+						modified.
+ @return				The SQL statement that was constructed.
+ @updated				2026-10-19
+ */
+- (NSString *) parameterizedStatement;
+/*!
+ @method				parameters
+ @discussion			This method will return the values to be bound to the placeholders in the
+						parameterized SQL statement, in the order that they appear.
+ @return				The values to be bound.
+ @updated				2026-10-19
+ */
+- (NSArray *) parameters;
+/*!
+ @method				temporaryTables
+ @discussion			This method will return the values of any long "IN" list in a subquery that must be
+						staged into a temporary table before the parameterized SQL statement is executed.
+ @return				The values to be staged, keyed by their slot in the temporary table.
+ @updated				2026-10-19
+ */
+- (NSDictionary *) temporaryTables;
 
 @end
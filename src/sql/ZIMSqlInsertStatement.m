@@ -16,36 +16,153 @@
 
 #import "ZIMSqlInsertStatement.h"
 
+/*!
+ @category		ZIMSqlInsertStatement (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMSqlInsertStatement (Private)
+/*!
+ @method			statementWithParameters:
+ @discussion		This method will build the SQL statement.
+ @param parameters	The array to which the bound values will be appended.  When nil, the values
+					will be rendered as literals.
+ @return			The SQL statement that was constructed.
+ @updated			2026-10-19
+ */
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters;
+@end
+
 @implementation ZIMSqlInsertStatement
 
 - (id) init {
 	if ((self = [super init])) {
 		_table = nil;
 		_column = [[NSMutableDictionary alloc] init];
+		_rows = [[NSMutableArray alloc] init];
+		_statement = nil;
+		_parameterizedStatement = nil;
+		_parameters = nil;
+		_returning = [[NSMutableArray alloc] init];
+		_temporaryTables = nil;
 	}
 	return self;
 }
 
 - (void) into: (NSString *)table {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_table = [ZIMSqlExpression prepareIdentifier: table maxCount: 2];
 }
 
 - (void) column: (NSString *)column value: (id)value {
-	[_column setObject: [ZIMSqlExpression prepareValue: value] forKey: [ZIMSqlExpression prepareIdentifier: column maxCount: 1]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	if (value == nil) {
+		value = [NSNull null];
+	}
+	[_column setObject: value forKey: [ZIMSqlExpression prepareIdentifier: column maxCount: 1]];
+}
+
+- (void) row: (NSDictionary *)values {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSMutableDictionary *row = [[NSMutableDictionary alloc] initWithCapacity: [values count]];
+	for (NSString *column in values) {
+		[row setObject: [values objectForKey: column] forKey: [ZIMSqlExpression prepareIdentifier: column maxCount: 1]];
+	}
+	[_rows addObject: row];
+}
+
+- (void) returning: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_returning addObject: [ZIMSqlExpression prepareReturning: column]];
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
-	
-	[sql appendFormat: @"INSERT INTO %@ ", _table];
+	if (_statement == nil) {
+		_statement = [self statementWithParameters: nil];
+	}
+	return _statement;
+}
 
+- (NSString *) parameterizedStatement {
+	if (_parameterizedStatement == nil) {
+		NSMutableArray *parameters = [[NSMutableArray alloc] init];
+		_temporaryTables = [[NSMutableDictionary alloc] init];
+		_parameterizedStatement = [self statementWithParameters: parameters];
+		_parameters = parameters;
+	}
+	return _parameterizedStatement;
+}
+
+- (NSArray *) parameters {
+	[self parameterizedStatement];
+	return _parameters;
+}
+
+- (NSDictionary *) temporaryTables {
+	[self parameterizedStatement];
+	return _temporaryTables;
+}
+
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters {
+	NSMutableArray *rows = [[NSMutableArray alloc] initWithCapacity: [_rows count] + 1];
 	if ([_column count] > 0) {
-		[sql appendFormat: @"(%@) VALUES (%@)", [[_column allKeys] componentsJoinedByString: @", "], [[_column allValues] componentsJoinedByString: @", "]];
+		[rows addObject: _column];
+	}
+	[rows addObjectsFromArray: _rows];
+
+	NSArray *columns = ([rows count] > 0) ? [[[rows objectAtIndex: 0] allKeys] sortedArrayUsingSelector: @selector(compare:)] : nil; // i.e. so that the same columns always render the same SQL statement
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 128 + 32 * [columns count] * MAX([rows count], (NSUInteger)1)];
+	NSMutableDictionary *tables = (parameters != nil) ? _temporaryTables : nil;
+	
+	[sql appendCString: "INSERT INTO "];
+	[sql appendString: _table];
+	[sql appendBytes: " " length: 1];
+
+	if ([columns count] > 0) {
+		[sql appendBytes: "(" length: 1];
+		[sql appendStrings: columns separator: ", "];
+		[sql appendCString: ") VALUES "];
+		[ZIMSqlInsertStatement appendRows: rows columns: columns toWriter: sql parameters: parameters temporaryTables: tables];
+	}
+
+	if ([_returning count] > 0) {
+		[sql appendCString: " RETURNING "];
+		[sql appendStrings: _returning separator: ", "];
 	}
 
-	[sql appendString: @";"];
+	[sql appendBytes: ";" length: 1];
 
-	return sql;
+	return [sql string];
+}
+
++ (void) appendRows: (NSArray *)rows columns: (NSArray *)columns toWriter: (ZIMSqlWriter *)sql parameters: (NSMutableArray *)parameters temporaryTables: (NSMutableDictionary *)tables {
+	NSUInteger count = [columns count];
+	int i = 0;
+	for (NSDictionary *row in rows) {
+		if ([row count] != count) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Every row must declare the same columns." userInfo: nil];
+		}
+		if (i > 0) {
+			[sql appendCString: ", "];
+		}
+		[sql appendBytes: "(" length: 1];
+		for (NSUInteger j = 0; j < count; j++) {
+			id value = [row objectForKey: [columns objectAtIndex: j]];
+			if (value == nil) {
+				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Every row must declare column '%@'.", [columns objectAtIndex: j]] userInfo: nil];
+			}
+			if (j > 0) {
+				[sql appendCString: ", "];
+			}
+			[ZIMSqlExpression appendValue: value toWriter: sql parameters: parameters temporaryTables: tables];
+		}
+		[sql appendBytes: ")" length: 1];
+		i++;
+	}
 }
 
 @end
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+#import "ZIMSqlStatement.h"
+
+#if !defined(ZIMSqlNormalizerCacheSize)
+#define ZIMSqlNormalizerCacheSize				512 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+/*!
+ @class					ZIMSqlNormalizer
+ @discussion			This class reduces an SQL statement to its shape so that statements which differ only
+						in their values, spacing, comments, keyword case, or identifier quoting share the same
+						identity (e.g. when aggregating metrics or logging slow queries).  Literals, numbers,
+						and parameters are replaced with "?", each IN-list of values is collapsed to "IN (?)",
+						and the normalized statement is hashed into a 64-bit FNV-1a fingerprint.
+ @updated				2026-10-19
+ @see					http://www.isthe.com/chongo/tech/comp/fnv/
+ */
+@interface ZIMSqlNormalizer : NSObject <ZIMSqlStatement> {
+
+	@protected
+		NSString *_statement;
+		uint64_t _fingerprint;
+
+}
+/*!
+ @method				initWithSqlStatement:
+ @discussion			This method initialize the class with the normalized form of the specified SQL
+						statement.
+ @param sql				The SQL statement to be normalized.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithSqlStatement: (NSString *)sql;
+/*!
+ @method				statement
+ @discussion			This method will return the normalized SQL statement.
+ @return				The normalized SQL statement.
+ @updated				2026-10-19
+ */
+- (NSString *) statement;
+/*!
+ @method				fingerprint
+ @discussion			This method will return the fingerprint of the normalized SQL statement.
+ @return				The 64-bit fingerprint.
+ @updated				2026-10-19
+ */
+- (uint64_t) fingerprint;
+/*!
+ @method				normalize:
+ @discussion			This method will return the normalizer for the specified SQL statement.  Results are
+						cached by the raw SQL statement, so that normalizing a statement again only costs a
+						cache lookup.
+ @param sql				The SQL statement to be normalized.
+ @return				The normalizer for the SQL statement.
+ @updated				2026-10-19
+ */
++ (ZIMSqlNormalizer *) normalize: (NSString *)sql;
+/*!
+ @method				fingerprint:
+ @discussion			This method will return the fingerprint of the specified SQL statement.
+ @param sql				The SQL statement to be fingerprinted.
+ @return				The 64-bit fingerprint.
+ @updated				2026-10-19
+ */
++ (uint64_t) fingerprint: (NSString *)sql;
+
+@end
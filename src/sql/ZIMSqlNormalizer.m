@@ -0,0 +1,287 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import "ZIMSqlNormalizer.h"
+#import "ZIMSqlTokenizer.h"
+#import "ZIMSqlWriter.h"
+
+/*!
+ @category				ZIMSqlNormalizer (Private)
+ @discussion			This category defines the prototpes for this class's private methods.
+ @updated				2026-10-19
+ */
+@interface ZIMSqlNormalizer (Private)
+/*!
+ @method				normalizeIdentifier:
+ @discussion			This method will remove the quotes from the specified identifier and fold its case,
+						re-quoting it only when it could not otherwise be parsed.
+ @param identifier		The identifier to be normalized.
+ @return				The normalized identifier.
+ @updated				2026-10-19
+ */
++ (NSString *) normalizeIdentifier: (NSString *)identifier;
+/*!
+ @method				isIdentifier:after:before:
+ @discussion			This method checks whether the specified keyword is being used as an identifier
+						(e.g. "key" in "SET key = ?" or "t.key") so that it can be normalized the same
+						way as its quoted form.
+ @param keyword			The keyword to be checked.
+ @param previous		The last of the normalized tokens.
+ @param next			The next token that is not whitespace.
+ @return				Whether the keyword is in an identifier's position.
+ @updated				2026-10-19
+ */
++ (BOOL) isIdentifier: (NSString *)keyword after: (NSString *)previous before: (NSString *)next;
+/*!
+ @method				isSign:
+ @discussion			This method checks whether the last of the normalized tokens is a unary plus or
+						minus sign.
+ @param tokens			The normalized tokens.
+ @return				Whether the last token is a sign.
+ @updated				2026-10-19
+ */
++ (BOOL) isSign: (NSArray *)tokens;
+/*!
+ @method				collapseLists:
+ @discussion			This method will collapse each IN-list of values to a single value.
+ @param tokens			The normalized tokens.
+ @return				The collapsed tokens.
+ @updated				2026-10-19
+ */
++ (NSArray *) collapseLists: (NSArray *)tokens;
+@end
+
+@implementation ZIMSqlNormalizer
+
+static NSCache *_cache = nil;
+
+- (id) initWithSqlStatement: (NSString *)sql {
+	if ((self = [super init])) {
+		ZIMSqlTokenizer *tokenizer = [[ZIMSqlTokenizer alloc] initWithSqlStatement: sql];
+		NSMutableArray *tokens = [[NSMutableArray alloc] initWithCapacity: [tokenizer count]];
+		NSString *lastToken = nil;
+		NSString *lastType = nil;
+		NSUInteger count = [tokenizer count];
+		for (NSUInteger i = 0; i < count; i++) {
+			NSString *type = [tokenizer typeAtIndex: i];
+			if ([type isEqualToString: ZIMSqlTokenWhitespace]) { // i.e. whitespace and comments
+				lastToken = nil;
+				lastType = nil;
+				continue;
+			}
+			NSString *token = [tokenizer stringAtIndex: i];
+			if ([type isEqualToString: ZIMSqlTokenLiteral] || [type isEqualToString: ZIMSqlTokenInteger] || [type isEqualToString: ZIMSqlTokenReal] || [type isEqualToString: ZIMSqlTokenHexadecimal]) {
+				if ([lastType isEqualToString: ZIMSqlTokenIdentifier] && [type isEqualToString: ZIMSqlTokenLiteral] && [[lastToken uppercaseString] isEqualToString: @"X"]) { // i.e. X'...'
+					[tokens replaceObjectAtIndex: [tokens count] - 1 withObject: @"?"];
+				}
+				else if (![lastType isEqualToString: ZIMSqlTokenParameter]) { // i.e. ?NNN
+					if ([ZIMSqlNormalizer isSign: tokens] && ![type isEqualToString: ZIMSqlTokenLiteral]) { // i.e. -NNN
+						[tokens removeLastObject];
+					}
+					[tokens addObject: @"?"];
+				}
+			}
+			else if ([type isEqualToString: ZIMSqlTokenParameter]) {
+				[tokens addObject: @"?"];
+			}
+			else if ([type isEqualToString: ZIMSqlTokenKeyword] || [type isEqualToString: ZIMSqlTokenIdentifier]) {
+				if ([lastToken isEqualToString: @":"] || [lastToken isEqualToString: @"@"] || [lastToken isEqualToString: @"$"]) { // i.e. :AAAA, @AAAA, and $AAAA
+					[tokens replaceObjectAtIndex: [tokens count] - 1 withObject: @"?"];
+					type = ZIMSqlTokenParameter;
+				}
+				else if ([type isEqualToString: ZIMSqlTokenKeyword]) {
+					NSString *next = nil;
+					for (NSUInteger j = i + 1; j < count; j++) {
+						if (![[tokenizer typeAtIndex: j] isEqualToString: ZIMSqlTokenWhitespace]) {
+							next = [tokenizer stringAtIndex: j];
+							break;
+						}
+					}
+					if ([ZIMSqlNormalizer isIdentifier: token after: [tokens lastObject] before: next]) { // i.e. key and [key] share the same shape
+						[tokens addObject: [ZIMSqlNormalizer normalizeIdentifier: token]];
+					}
+					else {
+						[tokens addObject: [token uppercaseString]];
+					}
+				}
+				else {
+					[tokens addObject: [ZIMSqlNormalizer normalizeIdentifier: token]];
+				}
+			}
+			else if ([type isEqualToString: ZIMSqlTokenOperator]) {
+				if ([token isEqualToString: @"=="]) {
+					[tokens addObject: @"="];
+				}
+				else if ([token isEqualToString: @"<>"]) {
+					[tokens addObject: @"!="];
+				}
+				else {
+					[tokens addObject: token];
+				}
+			}
+			else {
+				[tokens addObject: token];
+			}
+			lastToken = token;
+			lastType = type;
+		}
+		while ([[tokens lastObject] isEqualToString: @";"]) {
+			[tokens removeLastObject];
+		}
+
+		ZIMSqlWriter *writer = [[ZIMSqlWriter alloc] initWithCapacity: [sql length]];
+		NSString *previous = nil;
+		for (NSString *token in [ZIMSqlNormalizer collapseLists: tokens]) {
+			if ((previous != nil) && ![previous isEqualToString: @"("] && ![previous isEqualToString: @"."] && ![token isEqualToString: @")"] && ![token isEqualToString: @","] && ![token isEqualToString: @"."] && ![token isEqualToString: @";"]) {
+				[writer appendBytes: " " length: 1];
+			}
+			[writer appendString: token];
+			previous = token;
+		}
+
+		const unsigned char *bytes = (const unsigned char *)[writer UTF8String];
+		NSUInteger length = [writer length];
+		_fingerprint = 14695981039346656037ULL; // i.e. the FNV-1a 64-bit offset basis
+		for (NSUInteger i = 0; i < length; i++) {
+			_fingerprint ^= bytes[i];
+			_fingerprint *= 1099511628211ULL; // i.e. the FNV-1a 64-bit prime
+		}
+		_statement = [writer string];
+	}
+	return self;
+}
+
+- (NSString *) statement {
+	return _statement;
+}
+
+- (uint64_t) fingerprint {
+	return _fingerprint;
+}
+
++ (ZIMSqlNormalizer *) normalize: (NSString *)sql {
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		_cache = [[NSCache alloc] init];
+		[_cache setCountLimit: ZIMSqlNormalizerCacheSize];
+	});
+	ZIMSqlNormalizer *normalizer = [_cache objectForKey: sql];
+	if (normalizer == nil) {
+		normalizer = [[ZIMSqlNormalizer alloc] initWithSqlStatement: sql];
+		[_cache setObject: normalizer forKey: sql];
+	}
+	return normalizer;
+}
+
++ (uint64_t) fingerprint: (NSString *)sql {
+	return [[ZIMSqlNormalizer normalize: sql] fingerprint];
+}
+
++ (NSString *) normalizeIdentifier: (NSString *)identifier {
+	unichar quote = [identifier characterAtIndex: 0];
+	if ((quote == '[') || (quote == '"') || (quote == '`')) {
+		NSUInteger length = [identifier length];
+		unichar close = (quote == '[') ? ']' : quote;
+		BOOL isClosed = ((length > 1) && ([identifier characterAtIndex: length - 1] == close));
+		identifier = [identifier substringWithRange: NSMakeRange(1, length - ((isClosed) ? 2 : 1))];
+		if (quote != '[') {
+			NSString *escaped = [NSString stringWithCharacters: &quote length: 1];
+			identifier = [identifier stringByReplacingOccurrencesOfString: [escaped stringByAppendingString: escaped] withString: escaped];
+		}
+	}
+	identifier = [identifier lowercaseString];
+	NSCharacterSet *invalid = [[NSCharacterSet characterSetWithCharactersInString: @"abcdefghijklmnopqrstuvwxyz0123456789_"] invertedSet];
+	BOOL isBare = (([identifier length] > 0) && ([identifier rangeOfCharacterFromSet: invalid].location == NSNotFound) && !isdigit([identifier characterAtIndex: 0]) && ![ZIMSqlTokenizer isKeyword: identifier]);
+	if (!isBare) {
+		identifier = [NSString stringWithFormat: @"\"%@\"", [identifier stringByReplacingOccurrencesOfString: @"\"" withString: @"\"\""]];
+	}
+	return identifier;
+}
+
++ (BOOL) isIdentifier: (NSString *)keyword after: (NSString *)previous before: (NSString *)next {
+	NSString *uppercase = [keyword uppercaseString];
+	if ([uppercase isEqualToString: @"NULL"] || [uppercase hasPrefix: @"CURRENT_"]) { // i.e. keywords that are values
+		return NO;
+	}
+	if ([previous isEqualToString: @"."] || [next isEqualToString: @"."]) { // i.e. a qualified name
+		return YES;
+	}
+	static NSSet *operators = nil;
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		operators = [[NSSet alloc] initWithObjects: @"=", @"==", @"!=", @"<>", @"<", @"<=", @">", @">=", nil];
+	});
+	if ((next != nil) && [operators containsObject: next]) { // e.g. WHERE key = ? and SET key = ?
+		return YES;
+	}
+	if (([previous isEqualToString: @","] || [previous isEqualToString: @"("]) && ([next isEqualToString: @","] || [next isEqualToString: @")"])) { // e.g. INSERT INTO t (key, value)
+		return YES;
+	}
+	return NO;
+}
+
++ (BOOL) isSign: (NSArray *)tokens {
+	NSUInteger count = [tokens count];
+	if ((count == 0) || !([[tokens lastObject] isEqualToString: @"-"] || [[tokens lastObject] isEqualToString: @"+"])) {
+		return NO;
+	}
+	if (count == 1) {
+		return YES;
+	}
+	NSString *previous = [tokens objectAtIndex: count - 2];
+	if ([previous isEqualToString: @"?"] || [previous isEqualToString: @")"] || [previous hasPrefix: @"\""]) {
+		return NO;
+	}
+	NSCharacterSet *letters = [NSCharacterSet characterSetWithCharactersInString: @"abcdefghijklmnopqrstuvwxyz_"];
+	if ([letters characterIsMember: [previous characterAtIndex: 0]]) { // i.e. a bare identifier
+		return NO;
+	}
+	return YES; // i.e. preceded by an operator, a keyword, "(", or ","
+}
+
++ (NSArray *) collapseLists: (NSArray *)tokens {
+	NSMutableArray *collapsed = [[NSMutableArray alloc] initWithCapacity: [tokens count]];
+	NSUInteger count = [tokens count];
+	NSUInteger i = 0;
+	while (i < count) {
+		NSString *token = [tokens objectAtIndex: i];
+		[collapsed addObject: token];
+		i++;
+		if ([token isEqualToString: @"IN"] && (i < count) && [[tokens objectAtIndex: i] isEqualToString: @"("]) {
+			NSUInteger j = i + 1;
+			BOOL isList = NO;
+			while ((j + 1 < count) && [[tokens objectAtIndex: j] isEqualToString: @"?"]) {
+				NSString *next = [tokens objectAtIndex: j + 1];
+				if ([next isEqualToString: @")"]) {
+					isList = YES;
+					break;
+				}
+				if (![next isEqualToString: @","]) {
+					break;
+				}
+				j += 2;
+			}
+			if (isList) {
+				[collapsed addObject: @"("];
+				[collapsed addObject: @"?"];
+				[collapsed addObject: @")"];
+				i = j + 2;
+			}
+		}
+	}
+	return collapsed;
+}
+
+@end
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import "ZIMSqlStatement.h"
+
+/*!
+ @class					ZIMSqlParameterizedStatement
+ @discussion			This protocol specifies the contract for an SQL statement that can be rendered with
+						"?" placeholders in place of its values.  Because the SQL text no longer depends on
+						the values, statements that share the same shape will render the same SQL and can
+						reuse the same compiled statement.  A statement's plain SQL renders every value as a
+						literal, including each element of a very long "IN" list; such a statement should
+						instead be run with its parameterized SQL, its parameters, and its temporary tables
+						(see ZIMDbConnection's execute:withParameters:temporaryTables:).
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/bind_blob.html
+ */
+@protocol ZIMSqlParameterizedStatement <ZIMSqlStatement>
+
+@required
+/*!
+ @method				parameterizedStatement
+ @discussion			This method will return the SQL statement with "?" placeholders in place of its values.
+ @return				The SQL statement that was constructed.
+ @updated				2026-10-19
+ */
+- (NSString *) parameterizedStatement;
+/*!
+ @method				parameters
+ @discussion			This method will return the values to be bound to the placeholders in the
+						parameterized SQL statement, in the order that they appear.
+ @return				The values to be bound.
+ @updated				2026-10-19
+ */
+- (NSArray *) parameters;
+
+@optional
+/*!
+ @method				temporaryTables
+ @discussion			This method will return the values that must be staged into the connection's temporary
+						table before the parameterized SQL statement is executed, keyed by slot.
+ @return				The values to be staged.
+ @updated				2026-10-19
+ */
+- (NSDictionary *) temporaryTables;
+
+@end
@@ -25,9 +25,10 @@
 		_indicies = [[NSMutableArray alloc] init];
 		ZIMSqlTokenizer *tokenizer = [[ZIMSqlTokenizer alloc] initWithSqlStatement: sql];
 		NSString *lookback = @"";
-		for (NSDictionary *tuple in tokenizer) {
-			NSString *token = [tuple objectForKey: @"token"];
-			NSString *type = [tuple objectForKey: @"type"];
+		NSUInteger count = [tokenizer count];
+		for (NSUInteger i = 0; i < count; i++) {
+			NSString *type = [tokenizer typeAtIndex: i];
+			NSString *token = ([type isEqualToString: ZIMSqlTokenWhitespace]) ? nil : [tokenizer stringAtIndex: i];
 		    if ([type isEqualToString: ZIMSqlTokenKeyword]) {
 				[_tokens addObject: [token uppercaseString]];
 			}
@@ -69,11 +70,9 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
-	for (NSString *token in _tokens) {
-		[sql appendString: token];
-	}
-	return sql;
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 16 * [_tokens count]];
+	[sql appendStrings: _tokens separator: ""];
+	return [sql string];
 }
 
 + (NSString *) preparedStatement: (NSString *)sql withValues: (id)values, ... {
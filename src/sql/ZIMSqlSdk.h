@@ -19,6 +19,7 @@
 #import "ZIMSqlAlterTableStatement.h"
 #import "ZIMSqlAnalyzeStatement.h"
 #import "ZIMSqlAttachStatement.h"
+#import "ZIMSqlCondition.h"
 #import "ZIMSqlCreateIndexStatement.h"
 #import "ZIMSqlCreateTableStatement.h"
 #import "ZIMSqlCreateTriggerStatement.h"
@@ -35,6 +36,8 @@
 #import "ZIMSqlExplainStatement.h"
 #import "ZIMSqlExpression.h"
 #import "ZIMSqlInsertStatement.h"
+#import "ZIMSqlNormalizer.h"
+#import "ZIMSqlParameterizedStatement.h"
 #import "ZIMSqlPreparedStatement.h"
 #import "ZIMSqlReindexStatement.h"
 #import "ZIMSqlSelectStatement.h"
@@ -44,9 +47,11 @@
 #import "ZIMSqlShowTriggersStatement.h"
 #import "ZIMSqlShowViewsStatement.h"
 #import "ZIMSqlStatement.h"
+#import "ZIMSqlStatementSplitter.h"
 #import "ZIMSqlTokenizer.h"
 #import "ZIMSqlTransactionControlCommand.h"
 #import "ZIMSqlTruncateTableStatement.h"
 #import "ZIMSqlUpdateStatement.h"
 #import "ZIMSqlUpsertStatement.h"
 #import "ZIMSqlWrapper.h"
+#import "ZIMSqlWriter.h"
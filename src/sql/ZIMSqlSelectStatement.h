@@ -15,30 +15,67 @@
  */
 
 #import "ZIMSqlStatement.h"
+#import "ZIMSqlCondition.h"
+#import "ZIMSqlParameterizedStatement.h"
 #import "ZIMSqlDataManipulationCommand.h"
 
 /*!
  @class					ZIMSqlSelectStatement
- @discussion			This class represents an SQL select statement.
- @updated				2011-07-15
+ @discussion			This class represents an SQL select statement.  Copying a statement is cheap, which
+						allows a base query to be cloned and then refined.
+ @updated				2026-10-19
  @see					http://www.sqlite.org/lang_select.html
  */
-@interface ZIMSqlSelectStatement : NSObject <ZIMSqlStatement, ZIMSqlDataManipulationCommand> {
+@interface ZIMSqlSelectStatement : NSObject <NSCopying, ZIMSqlStatement, ZIMSqlParameterizedStatement, ZIMSqlDataManipulationCommand> {
 
 	@protected
+		NSMutableArray *_with;
+		BOOL _recursive;
 		BOOL _distinct;
+		BOOL _forceJoinOrder;
 		NSMutableArray *_column;
 		NSMutableArray *_table;
 		NSMutableArray *_join;
-		NSMutableArray *_where;
+		ZIMSqlCondition *_where;
 		NSMutableArray *_groupBy;
-		NSMutableArray *_having;
+		ZIMSqlCondition *_having;
+		NSMutableArray *_window;
 		NSMutableArray *_orderBy;
+		NSMutableArray *_orderKeys;
+		NSArray *_cursor;
 		NSInteger _limit;
 		NSInteger _offset;
 		NSMutableArray *_combine;
+		NSString *_statement;
+		NSString *_parameterizedStatement;
+		NSArray *_parameters;
+		NSMutableDictionary *_temporaryTables;
 
 }
+/*!
+ @method				with:as:
+ @discussion			This method will add a common table expression (i.e. a named subquery) to the
+						"WITH" clause of the SQL statement.  The subquery is copied, so later changes to it
+						have no effect on this statement.
+ @param statement		The select statement that defines the common table expression.
+ @param table			The name by which the common table expression will be referenced.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_with.html
+ */
+- (void) with: (ZIMSqlSelectStatement *)statement as: (NSString *)table;
+/*!
+ @method				withRecursive:as:
+ @discussion			This method will add a recursive common table expression to the "WITH" clause of
+						the SQL statement.  The select statement should declare the initial rows and then use
+						combine:operator: to append the recursive select statement, which references the
+						common table expression by name.  Use "UNION" rather than "UNION ALL" to stop at
+						cycles.
+ @param statement		The select statement that defines the common table expression.
+ @param table			The name by which the common table expression will be referenced.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_with.html#recursive_common_table_expressions
+ */
+- (void) withRecursive: (ZIMSqlSelectStatement *)statement as: (NSString *)table;
 /*!
  @method				distinct:
  @discussion			This method will add the "DISTINCT" keyword to the SQL statement.
@@ -61,6 +98,44 @@
  @updated				2011-10-30
  */
 - (void) column: (NSString *)column alias: (NSString *)alias;
+/*!
+ @method				column:arguments:alias:
+ @discussion			This method will add an aggregate function to the SQL statement, which is combined
+						with a group by clause to reduce the result set within SQLite.
+ @param function		The name of the function to be called (e.g. ZIMSqlFunctionSum).
+ @param arguments		The arguments to be passed to the function.  A string is treated as a column, "*"
+						as every column, and a number as a literal.
+ @param alias			The alias to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_aggfunc.html
+ */
+- (void) column: (NSString *)function arguments: (NSArray *)arguments alias: (NSString *)alias;
+/*!
+ @method				column:arguments:over:alias:
+ @discussion			This method will add a window function to the SQL statement (e.g. a ranking, a
+						running total, or a lag/lead), which is evaluated over the specified named window.
+ @param function		The name of the function to be called (e.g. ZIMSqlFunctionRowNumber).
+ @param arguments		The arguments to be passed to the function.
+ @param window			The name of the window, which must be declared via the window methods.
+ @param alias			The alias to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/windowfunctions.html
+ */
+- (void) column: (NSString *)function arguments: (NSArray *)arguments over: (NSString *)window alias: (NSString *)alias;
+/*!
+ @method				column:arguments:filter:over:alias:
+ @discussion			This method will add an aggregate or window function to the SQL statement.  When a
+						filter is specified, only the rows that satisfy it are passed to the function.
+ @param function		The name of the function to be called.
+ @param arguments		The arguments to be passed to the function.
+ @param filter			The condition used by the "FILTER" clause or nil for no filter.  Requires
+						SQLite 3.30 or later.
+ @param window			The name of the window or nil to call the function as an aggregate.
+ @param alias			The alias to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_aggfunc.html#aggfilter
+ */
+- (void) column: (NSString *)function arguments: (NSArray *)arguments filter: (ZIMSqlCondition *)filter over: (NSString *)window alias: (NSString *)alias;
 /*!
  @method				from:
  @discussion			This method will add a from clause to the SQL statement.
@@ -76,6 +151,44 @@
  @updated				2011-10-30
  */
 - (void) from: (NSString *)table alias: (NSString *)alias;
+/*!
+ @method				from:indexedBy:
+ @discussion			This method will add a from clause to the SQL statement that requires the query
+						planner to use the specified index to look up rows in the table.  SQLite fails to
+						prepare the statement when the index does not exist.
+ @param table			The table to used in the clause.
+ @param index			The index to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) from: (NSString *)table indexedBy: (NSString *)index;
+/*!
+ @method				from:notIndexed:
+ @discussion			This method will add a from clause to the SQL statement that, when specified,
+						prevents the query planner from using any index on the table.
+ @param table			The table to used in the clause.
+ @param notIndexed		This will determine whether the "NOT INDEXED" hint should be added.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) from: (NSString *)table notIndexed: (BOOL)notIndexed;
+/*!
+ @method				indexedBy:
+ @discussion			This method will require the query planner to use the specified index to look up
+						rows in the table last declared in the from clause.
+ @param index			The index to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) indexedBy: (NSString *)index;
+/*!
+ @method				notIndexed
+ @discussion			This method will prevent the query planner from using any index on the table last
+						declared in the from clause.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) notIndexed;
 /*!
  @method				join:
  @discussion			This method will add a join clause to the SQL statement.
@@ -108,6 +221,26 @@
  @updated				2011-10-30
  */
 - (void) join: (NSString *)table alias: (NSString *)alias type: (NSString *)type;
+/*!
+ @method				join:indexedBy:
+ @discussion			This method will add a join clause to the SQL statement that requires the query
+						planner to use the specified index to look up rows in the joined table.
+ @param table			The table to used in the clause.
+ @param index			The index to be used.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_indexedby.html
+ */
+- (void) join: (NSString *)table indexedBy: (NSString *)index;
+/*!
+ @method				forceJoinOrder:
+ @discussion			This method will force the query planner to join the tables in the order that
+						they are declared by rendering every inner join (and every table in the from clause)
+						as a "CROSS JOIN", which SQLite never reorders.
+ @param force			This will determine whether the join order should be forced.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/optoverview.html#manual_control_of_query_plans_using_cross_join
+ */
+- (void) forceJoinOrder: (BOOL)force;
 /*!
  @method				joinOn:operator:column:
  @discussion			This method will add a join condition to the last defined join clause.
@@ -206,6 +339,16 @@
  @updated				2011-05-19
  */
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector; // wrap primitives with NSNumber
+/*!
+ @method				where:connector:
+ @discussion			This method will add a copy of the specified condition to the where clause.  A
+						group is enclosed in parentheses (e.g. so that the where clause of another statement
+						can be reused).
+ @param condition		The condition to be added.
+ @param connector		The connector to be used.
+ @updated				2026-10-19
+ */
+- (void) where: (ZIMSqlCondition *)condition connector: (NSString *)connector;
 /*!
  @method				groupBy:
  @discussion			This method will add a group by clause to the SQL statement.
@@ -266,6 +409,34 @@
  @updated				2011-05-19
  */
 - (void) groupByHaving: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector; // wrap primitives with NSNumber
+/*!
+ @method				window:partitionBy:
+ @discussion			This method will add a partition by column to the specified named window, which
+						will be declared in the "WINDOW" clause of the SQL statement.
+ @param name			The name of the window.
+ @param column			The column by which the window is partitioned.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/windowfunctions.html#the_window_clause
+ */
+- (void) window: (NSString *)name partitionBy: (NSString *)column;
+/*!
+ @method				window:orderBy:descending:
+ @discussion			This method will add an order by column to the specified named window.
+ @param name			The name of the window.
+ @param column			The column by which the window is ordered.
+ @param descending		This will determine whether the column should be ordered in descending order.
+ @updated				2026-10-19
+ */
+- (void) window: (NSString *)name orderBy: (NSString *)column descending: (BOOL)descending;
+/*!
+ @method				window:frame:
+ @discussion			This method will set the frame specification of the specified named window.
+ @param name			The name of the window.
+ @param frame			The frame specification (e.g. ZIMSqlWindowFrameRunning).
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/windowfunctions.html#frame_specifications
+ */
+- (void) window: (NSString *)name frame: (NSString *)frame;
 /*!
  @method				orderBy:
  @discussion			This method will add an order by clause to the SQL statement.
@@ -318,20 +489,72 @@
  @updated				2011-06-27
  */
 - (void) offset: (NSInteger)offset;
+/*!
+ @method				seekAfter:
+ @discussion			This method will restrict the result set to the records that follow the specified
+						cursor in the order declared by the order by clause (i.e. keyset pagination).  Unlike
+						an offset, the skipped records are never visited, so every page costs the same.  The
+						ordering should be unique (e.g. end with the primary key).  NULLs, including those in
+						the cursor, follow the order declared by the order by clause.  A cursor may not be
+						declared on a compound select statement.
+ @param cursor			The cursor returned by cursorForRecord: for the last record of the previous page,
+						or nil to start from the first page.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/rowvalue.html#scrolling_window_queries
+ */
+- (void) seekAfter: (NSArray *)cursor;
+/*!
+ @method				cursorForRecord:
+ @discussion			This method will create the cursor that identifies the specified record's position
+						in the order declared by the order by clause.  The cursor should be treated as opaque.
+ @param record			The record (i.e. either a dictionary or a model).
+ @return				The cursor for the record.
+ @updated				2026-10-19
+ */
+- (NSArray *) cursorForRecord: (id)record;
 /*!
  @method				combine:operator:
- @discussion			This method will combine a select statement using the specified operator.
+ @discussion			This method will combine a select statement using the specified operator.  A select
+						statement that begins with a "WITH" clause (e.g. the statement of a builder that
+						declared a common table expression) is appended as a subquery, since SQLite only
+						allows a "WITH" clause at the start of a compound select statement.
  @param statement		The select statement that will be appended.
  @param operator		The operator to be used.  Must use UNION, UNION ALL, INTERSECT, or EXCEPT.
- @updated				2011-10-30
+ @updated				2026-10-19
  */
 - (void) combine: (NSString *)statement operator: (NSString *)operator;
 /*!
  @method				statement
- @discussion			This method will return the SQL statement.
+ @discussion			This method will return the SQL statement.  The statement is only rebuilt
+						after the builder has been modified; otherwise, the cached statement is returned.
  @return				The SQL statement that was constructed.
- @updated				2011-10-19
+ @updated				2026-10-19
  */
 - (NSString *) statement;
+/*!
+ @method				parameterizedStatement
+ @discussion			This method will return the SQL statement with "?" placeholders in place of its
+						values.  Like the statement method, it is only rebuilt after the builder has been
+						modified.
+ @return				The SQL statement that was constructed.
+ @updated				2026-10-19
+ */
+- (NSString *) parameterizedStatement;
+/*!
+ @method				parameters
+ @discussion			This method will return the values to be bound to the placeholders in the
+						parameterized SQL statement, in the order that they appear.
+ @return				The values to be bound.
+ @updated				2026-10-19
+ */
+- (NSArray *) parameters;
+/*!
+ @method				temporaryTables
+ @discussion			This method will return the values of any long "IN" list that must be staged into
+						a temporary table before the parameterized SQL statement is executed.
+ @return				The values to be staged, keyed by their slot in the temporary table.
+ @updated				2026-10-19
+ */
+- (NSDictionary *) temporaryTables;
 
 @end
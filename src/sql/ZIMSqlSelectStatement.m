@@ -14,48 +14,222 @@
  * limitations under the License.
  */
 
-#import "NSString+ZIMString.h"
 #import "ZIMSqlSelectStatement.h"
 
+/*!
+ @category		ZIMSqlSelectStatement (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMSqlSelectStatement (Private)
+/*!
+ @method			statementWithParameters:
+ @discussion		This method will build the SQL statement.
+ @param parameters	The array to which the bound values will be appended.  When nil, the values
+					will be rendered as literals.
+ @return			The SQL statement that was constructed.
+ @updated			2026-10-19
+ */
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters;
+/*!
+ @method			seekCondition
+ @discussion		This method will build the condition that restricts the result set to the records
+					that follow the cursor.  When every column is sorted in the same direction with its NULLs
+					first and no cursor value is NULL, a row value comparison is used; otherwise, the comparison
+					is expanded into a disjunction that places the NULLs where the order by clause sorts them.
+ @return			The condition or nil if no cursor has been declared.
+ @updated			2026-10-19
+ */
+- (ZIMSqlCondition *) seekCondition;
+/*!
+ @method			areNullsFirst:
+ @discussion		This method checks whether NULLs come first in the specified column's sort order.
+ @param orderKey	The column's order key.
+ @return			Whether NULLs come first.
+ @updated			2026-10-19
+ */
+- (BOOL) areNullsFirst: (NSArray *)orderKey;
+/*!
+ @method			windowNamed:
+ @discussion		This method will return the named window's definition, declaring it if needed.
+ @param name		The name of the window.
+ @return			The window's definition (i.e. its name, partition columns, order columns, and frame).
+ @updated			2026-10-19
+ */
+- (NSMutableArray *) windowNamed: (NSString *)name;
+@end
+
 @implementation ZIMSqlSelectStatement
 
 - (id) init {
 	if ((self = [super init])) {
+		_with = [[NSMutableArray alloc] init];
+		_recursive = NO;
 		_distinct = NO;
+		_forceJoinOrder = NO;
 		_column = [[NSMutableArray alloc] init];
 		_table = [[NSMutableArray alloc] init];
 		_join = [[NSMutableArray alloc] init];
-		_where = [[NSMutableArray alloc] init];
+		_where = [ZIMSqlCondition group];
 		_groupBy = [[NSMutableArray alloc] init];
-		_having = [[NSMutableArray alloc] init];
+		_having = [ZIMSqlCondition group];
+		_window = [[NSMutableArray alloc] init];
 		_orderBy = [[NSMutableArray alloc] init];
+		_orderKeys = [[NSMutableArray alloc] init];
+		_cursor = nil;
 		_limit = 0;
 		_offset = 0;
 		_combine = [[NSMutableArray alloc] init];
+		_statement = nil;
+		_parameterizedStatement = nil;
+		_parameters = nil;
+		_temporaryTables = nil;
 	}
 	return self;
 }
 
+- (void) with: (ZIMSqlSelectStatement *)statement as: (NSString *)table {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	if (![statement isKindOfClass: [ZIMSqlSelectStatement class]]) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only declare a select statement as a common table expression." userInfo: nil];
+	}
+	NSString *name = [ZIMSqlExpression prepareIdentifier: table maxCount: 1];
+	for (NSArray *with in _with) {
+		if ([[with objectAtIndex: 0] isEqualToString: name]) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Common table expression '%@' has already been declared.", table] userInfo: nil];
+		}
+	}
+	[_with addObject: [NSArray arrayWithObjects: name, [statement copy], nil]];
+}
+
+- (void) withRecursive: (ZIMSqlSelectStatement *)statement as: (NSString *)table {
+	[self with: statement as: table];
+	_recursive = YES; // i.e. SQLite applies "RECURSIVE" to the whole clause
+}
+
 - (void) distinct: (BOOL)distinct {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_distinct = distinct;
 }
 
 - (void) column: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	[_column addObject: [ZIMSqlExpression prepareIdentifier: column]];
 }
 
 - (void) column: (NSString *)column alias: (NSString *)alias {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	[_column addObject: [NSString stringWithFormat: @"%@ AS %@", [ZIMSqlExpression prepareIdentifier: column], [ZIMSqlExpression prepareIdentifier: alias maxCount: 1]]];
 }
 
+- (void) column: (NSString *)function arguments: (NSArray *)arguments alias: (NSString *)alias {
+	[self column: function arguments: arguments filter: nil over: nil alias: alias];
+}
+
+- (void) column: (NSString *)function arguments: (NSArray *)arguments over: (NSString *)window alias: (NSString *)alias {
+	[self column: function arguments: arguments filter: nil over: window alias: alias];
+}
+
+- (void) column: (NSString *)function arguments: (NSArray *)arguments filter: (ZIMSqlCondition *)filter over: (NSString *)window alias: (NSString *)alias {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSMutableString *call = [[NSMutableString alloc] initWithString: [ZIMSqlExpression prepareFunction: function]];
+	[call appendString: @"("];
+	int i = 0;
+	for (id argument in arguments) {
+		if (i > 0) {
+			[call appendString: @", "];
+		}
+		if ([argument isKindOfClass: [NSNumber class]]) {
+			[call appendString: [ZIMSqlExpression prepareValue: argument]];
+		}
+		else if ([argument isKindOfClass: [NSString class]] && [argument isEqualToString: @"*"]) {
+			[call appendString: @"*"];
+		}
+		else if ([argument isKindOfClass: [NSString class]]) {
+			[call appendString: [ZIMSqlExpression prepareIdentifier: argument]];
+		}
+		else {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Invalid function argument '%@' provided.", argument] userInfo: nil];
+		}
+		i++;
+	}
+	[call appendString: @")"];
+	NSMutableString *suffix = [[NSMutableString alloc] init];
+	if ((filter != nil) && ![filter isEmpty]) {
+		[call appendString: @" FILTER (WHERE "];
+		[suffix appendString: @")"];
+	}
+	if (window != nil) {
+		[suffix appendFormat: @" OVER %@", [ZIMSqlExpression prepareIdentifier: window maxCount: 1]];
+	}
+	if (alias != nil) {
+		[suffix appendFormat: @" AS %@", [ZIMSqlExpression prepareIdentifier: alias maxCount: 1]];
+	}
+	if ((filter != nil) && ![filter isEmpty]) {
+		// Note: The filter is rendered with the rest of the statement so that its values may be bound.
+		[_column addObject: [NSArray arrayWithObjects: call, [filter copy], suffix, nil]];
+	}
+	else {
+		[call appendString: suffix];
+		[_column addObject: call];
+	}
+}
+
 - (void) from: (NSString *)table {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	[_table addObject: [ZIMSqlExpression prepareIdentifier: table]];
 }
 
 - (void) from: (NSString *)table alias: (NSString *)alias {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	[_table addObject: [NSString stringWithFormat: @"%@ %@", [ZIMSqlExpression prepareIdentifier: table], [ZIMSqlExpression prepareIdentifier: alias maxCount: 1]]];
 }
 
+- (void) from: (NSString *)table indexedBy: (NSString *)index {
+	[self from: table];
+	[self indexedBy: index];
+}
+
+- (void) from: (NSString *)table notIndexed: (BOOL)notIndexed {
+	[self from: table];
+	if (notIndexed) {
+		[self notIndexed];
+	}
+}
+
+- (void) indexedBy: (NSString *)index {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSString *table = [_table lastObject];
+	if (table == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a from clause before declaring an index hint." userInfo: nil];
+	}
+	if (([table rangeOfString: @" INDEXED BY "].location != NSNotFound) || [table hasSuffix: @" NOT INDEXED"]) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only declare one index hint per table." userInfo: nil];
+	}
+	[_table replaceObjectAtIndex: [_table count] - 1 withObject: [NSString stringWithFormat: @"%@ INDEXED BY %@", table, [ZIMSqlExpression prepareIdentifier: index maxCount: 1]]];
+}
+
+- (void) notIndexed {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSString *table = [_table lastObject];
+	if (table == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a from clause before declaring an index hint." userInfo: nil];
+	}
+	if (([table rangeOfString: @" INDEXED BY "].location != NSNotFound) || [table hasSuffix: @" NOT INDEXED"]) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only declare one index hint per table." userInfo: nil];
+	}
+	[_table replaceObjectAtIndex: [_table count] - 1 withObject: [NSString stringWithFormat: @"%@ NOT INDEXED", table]];
+}
+
 - (void) join: (NSString *)table {
 	[self join: table type: ZIMSqlJoinTypeInner];
 }
@@ -65,13 +239,30 @@
 }
 
 - (void) join: (NSString *)table type: (NSString *)type {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSString *join = [NSString stringWithFormat: @"%@ JOIN %@", [ZIMSqlExpression prepareJoinType: type], [ZIMSqlExpression prepareIdentifier: table]];
-	[_join addObject: [NSArray arrayWithObjects: join, [[NSMutableArray alloc] init], [[NSMutableArray alloc] init], nil]];
+	[_join addObject: [NSArray arrayWithObjects: join, [ZIMSqlCondition group], [[NSMutableArray alloc] init], nil]];
 }
 
 - (void) join: (NSString *)table alias: (NSString *)alias type: (NSString *)type {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSString *join = [NSString stringWithFormat: @"%@ JOIN %@ %@", [ZIMSqlExpression prepareJoinType: type], [ZIMSqlExpression prepareIdentifier: table], [ZIMSqlExpression prepareIdentifier: alias maxCount: 1]];
-	[_join addObject: [NSArray arrayWithObjects: join, [[NSMutableArray alloc] init], [[NSMutableArray alloc] init], nil]];
+	[_join addObject: [NSArray arrayWithObjects: join, [ZIMSqlCondition group], [[NSMutableArray alloc] init], nil]];
+}
+
+- (void) join: (NSString *)table indexedBy: (NSString *)index {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSString *join = [NSString stringWithFormat: @"%@ JOIN %@ INDEXED BY %@", ZIMSqlJoinTypeInner, [ZIMSqlExpression prepareIdentifier: table], [ZIMSqlExpression prepareIdentifier: index maxCount: 1]];
+	[_join addObject: [NSArray arrayWithObjects: join, [ZIMSqlCondition group], [[NSMutableArray alloc] init], nil]];
+}
+
+- (void) forceJoinOrder: (BOOL)force {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	_forceJoinOrder = force;
 }
 
 - (void) joinOn: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 {
@@ -79,15 +270,16 @@
 }
 
 - (void) joinOn: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSUInteger length = [_join count];
 	if (length > 0) {
 		NSUInteger index = length - 1;
-		NSMutableArray *joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 2];
-		if ([joinCondition count] > 0) {
+		if ([(NSArray *)[[_join objectAtIndex: index] objectAtIndex: 2] count] > 0) {
 			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May not declare two different types of constraints on a JOIN statement." userInfo: nil];
 		}
-		joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 1];
-		[joinCondition addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column1], [operator uppercaseString], [ZIMSqlExpression prepareIdentifier: column2]], nil]];
+		ZIMSqlCondition *joinCondition = (ZIMSqlCondition *)[[_join objectAtIndex: index] objectAtIndex: 1];
+		[joinCondition addCondition: [ZIMSqlCondition predicate: column1 operator: operator column: column2] connector: connector];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a JOIN clause before declaring a constraint." userInfo: nil];
@@ -99,35 +291,16 @@
 }
 
 - (void) joinOn: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSUInteger length = [_join count];
 	if (length > 0) {
 		NSUInteger index = length - 1;
-		NSMutableArray *joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 2];
-		if ([joinCondition count] > 0) {
+		if ([(NSArray *)[[_join objectAtIndex: index] objectAtIndex: 2] count] > 0) {
 			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May not declare two different types of constraints on a JOIN statement." userInfo: nil];
 		}
-		joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 1];
-		operator = [operator uppercaseString];
-		if ([operator isEqualToString: ZIMSqlOperatorBetween] || [operator isEqualToString: ZIMSqlOperatorNotBetween]) {
-			if (![value isKindOfClass: [NSArray class]]) {
-				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-			}
-			[joinCondition addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@ AND %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 0]], [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 1]]], nil]];
-		}
-		else {
-			if (([operator isEqualToString: ZIMSqlOperatorIn] || [operator isEqualToString: ZIMSqlOperatorNotIn]) && ![value isKindOfClass: [NSArray class]]) {
-				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-			}
-			else if ([value isKindOfClass: [NSNull class]]) {
-				if ([operator isEqualToString: ZIMSqlOperatorEqualTo]) {
-					operator = ZIMSqlOperatorIs;
-				}
-				else if ([operator isEqualToString: ZIMSqlOperatorNotEqualTo] || [operator isEqualToString: @"!="]) {
-					operator = ZIMSqlOperatorIsNot;
-				}
-			}
-			[joinCondition addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: value]], nil]];
-		}
+		ZIMSqlCondition *joinCondition = (ZIMSqlCondition *)[[_join objectAtIndex: index] objectAtIndex: 1];
+		[joinCondition addCondition: [ZIMSqlCondition predicate: column operator: operator value: value] connector: connector];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a JOIN clause before declaring a constraint." userInfo: nil];
@@ -135,14 +308,15 @@
 }
 
 - (void) joinUsing: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSUInteger length = [_join count];
 	if (length > 0) {
 		NSUInteger index = length - 1;
-		NSMutableArray *joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 1];
-		if ([joinCondition count] > 0) {
+		if ([(ZIMSqlCondition *)[[_join objectAtIndex: index] objectAtIndex: 1] count] > 0) {
 			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May not declare two different types of constraints on a JOIN statement." userInfo: nil];
 		}
-		joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 2];
+		NSMutableArray *joinCondition = (NSMutableArray *)[[_join objectAtIndex: index] objectAtIndex: 2];
 		[joinCondition addObject: [ZIMSqlExpression prepareIdentifier: column]];
 	}
 	else {
@@ -155,7 +329,9 @@
 }
 
 - (void) whereBlock: (NSString *)brace connector: (NSString *)connector {
-	[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [ZIMSqlExpression prepareEnclosure: brace], nil]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where block: brace connector: connector];
 }
 
 - (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 {
@@ -163,7 +339,9 @@
 }
 
 - (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector {
-	[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column1], [operator uppercaseString], [ZIMSqlExpression prepareIdentifier: column2]], nil]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where addCondition: [ZIMSqlCondition predicate: column1 operator: operator column: column2] connector: connector];
 }
 
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value {
@@ -171,30 +349,20 @@
 }
 
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector {
-	operator = [operator uppercaseString];
-	if ([operator isEqualToString: ZIMSqlOperatorBetween] || [operator isEqualToString: ZIMSqlOperatorNotBetween]) {
-		if (![value isKindOfClass: [NSArray class]]) {
-			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-		}
-		[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@ AND %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 0]], [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 1]]], nil]];
-	}
-	else {
-		if (([operator isEqualToString: ZIMSqlOperatorIn] || [operator isEqualToString: ZIMSqlOperatorNotIn]) && ![value isKindOfClass: [NSArray class]]) {
-			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-		}
-		else if ([value isKindOfClass: [NSNull class]]) {
-			if ([operator isEqualToString: ZIMSqlOperatorEqualTo]) {
-				operator = ZIMSqlOperatorIs;
-			}
-			else if ([operator isEqualToString: ZIMSqlOperatorNotEqualTo] || [operator isEqualToString: @"!="]) {
-				operator = ZIMSqlOperatorIsNot;
-			}
-		}
-		[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: value]], nil]];
-	}
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where addCondition: [ZIMSqlCondition predicate: column operator: operator value: value] connector: connector];
+}
+
+- (void) where: (ZIMSqlCondition *)condition connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where addCondition: [condition copy] connector: connector];
 }
 
 - (void) groupBy: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	[_groupBy addObject: [ZIMSqlExpression prepareIdentifier: column]];
 }
 
@@ -203,8 +371,10 @@
 }
 
 - (void) groupByHavingBlock: (NSString *)brace connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	if ([_groupBy count] > 0) {
-		[_having addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [ZIMSqlExpression prepareEnclosure: brace], nil]];
+		[_having block: brace connector: connector];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a GROUP BY clause before declaring a constraint." userInfo: nil];
@@ -216,8 +386,10 @@
 }
 
 - (void) groupByHaving: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	if ([_groupBy count] > 0) {
-		[_having addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column1], [operator uppercaseString], [ZIMSqlExpression prepareIdentifier: column2]], nil]];
+		[_having addCondition: [ZIMSqlCondition predicate: column1 operator: operator column: column2] connector: connector];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a GROUP BY clause before declaring a constraint." userInfo: nil];
@@ -229,34 +401,35 @@
 }
 
 - (void) groupByHaving: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	if ([_groupBy count] > 0) {
-		operator = [operator uppercaseString];
-		if ([operator isEqualToString: ZIMSqlOperatorBetween] || [operator isEqualToString: ZIMSqlOperatorNotBetween]) {
-			if (![value isKindOfClass: [NSArray class]]) {
-				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-			}
-			[_having addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@ AND %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 0]], [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 1]]], nil]];
-		}
-		else {
-			if (([operator isEqualToString: ZIMSqlOperatorIn] || [operator isEqualToString: ZIMSqlOperatorNotIn]) && ![value isKindOfClass: [NSArray class]]) {
-				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-			}
-			else if ([value isKindOfClass: [NSNull class]]) {
-				if ([operator isEqualToString: ZIMSqlOperatorEqualTo]) {
-					operator = ZIMSqlOperatorIs;
-				}
-				else if ([operator isEqualToString: ZIMSqlOperatorNotEqualTo] || [operator isEqualToString: @"!="]) {
-					operator = ZIMSqlOperatorIsNot;
-				}
-			}
-			[_having addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: value]], nil]];
-		}
+		[_having addCondition: [ZIMSqlCondition predicate: column operator: operator value: value] connector: connector];
 	}
 	else {
 		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare a GROUP BY clause before declaring a constraint." userInfo: nil];
 	}
 }
 
+- (void) window: (NSString *)name partitionBy: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[[[self windowNamed: name] objectAtIndex: 1] addObject: [ZIMSqlExpression prepareIdentifier: column]];
+}
+
+- (void) window: (NSString *)name orderBy: (NSString *)column descending: (BOOL)descending {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[[[self windowNamed: name] objectAtIndex: 2] addObject: [NSString stringWithFormat: @"%@ %@", [ZIMSqlExpression prepareIdentifier: column], [ZIMSqlExpression prepareSortOrder: descending]]];
+}
+
+- (void) window: (NSString *)name frame: (NSString *)frame {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	NSMutableArray *definition = [self windowNamed: name];
+	[definition replaceObjectAtIndex: 3 withObject: [ZIMSqlExpression prepareWindowFrame: frame]];
+}
+
 - (void) orderBy: (NSString *)column {
 	[self orderBy: column descending: NO nulls: nil];
 }
@@ -270,9 +443,14 @@
 }
 
 - (void) orderBy: (NSString *)column descending: (BOOL)descending nulls: (NSString *)weight {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSString *field = [ZIMSqlExpression prepareIdentifier: column];
 	NSString *order = [ZIMSqlExpression prepareSortOrder: descending];
 	weight = [ZIMSqlExpression prepareSortWeight: weight];
+	NSString *name = [[column componentsSeparatedByString: @"."] lastObject];
+	name = [name stringByTrimmingCharactersInSet: [NSCharacterSet characterSetWithCharactersInString: @" []\"'`"]];
+	[_orderKeys addObject: [NSArray arrayWithObjects: field, name, [NSNumber numberWithBool: descending], weight, nil]];
 	if ([weight isEqualToString: @"FIRST"]) {
 		[_orderBy addObject: [NSString stringWithFormat: @"CASE WHEN %@ IS NULL THEN 0 ELSE 1 END, %@ %@", field, field, order]];
 	}
@@ -285,115 +463,382 @@
 }
 
 - (void) limit: (NSInteger)limit {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_limit = [ZIMSqlExpression prepareNaturalNumber: limit];
 }
 
 - (void) offset: (NSInteger)offset {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_offset = [ZIMSqlExpression prepareNaturalNumber: offset];
 }
 
+- (void) seekAfter: (NSArray *)cursor {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	if (cursor != nil) {
+		if ([_orderKeys count] == 0) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare an ORDER BY clause before declaring a cursor." userInfo: nil];
+		}
+		if ([cursor count] != [_orderKeys count]) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Cursor must have one value for each column in the ORDER BY clause." userInfo: nil];
+		}
+		if ([_combine count] > 0) { // i.e. the WHERE clause would only restrict the first select statement
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May not declare a cursor on a compound select statement." userInfo: nil];
+		}
+	}
+	_cursor = [cursor copy];
+}
+
+- (NSArray *) cursorForRecord: (id)record {
+	NSMutableArray *cursor = [[NSMutableArray alloc] initWithCapacity: [_orderKeys count]];
+	for (NSArray *orderKey in _orderKeys) {
+		id value = [record valueForKey: [orderKey objectAtIndex: 1]];
+		[cursor addObject: (value != nil) ? value : [NSNull null]];
+	}
+	return cursor;
+}
+
+- (ZIMSqlCondition *) seekCondition {
+	if (_cursor == nil) {
+		return nil;
+	}
+	NSUInteger count = [_orderKeys count];
+	if ([_cursor count] != count) { // i.e. the order by clause was changed after the cursor was declared
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Cursor must have one value for each column in the ORDER BY clause." userInfo: nil];
+	}
+	BOOL isUniform = YES; // i.e. every column is sorted in the same direction with its NULLs first and is not NULL in the cursor
+	BOOL descending = [[[_orderKeys objectAtIndex: 0] objectAtIndex: 2] boolValue];
+	for (NSUInteger i = 0; i < count; i++) {
+		NSArray *orderKey = [_orderKeys objectAtIndex: i];
+		if (([[orderKey objectAtIndex: 2] boolValue] != descending) || ![self areNullsFirst: orderKey] || [[_cursor objectAtIndex: i] isKindOfClass: [NSNull class]]) {
+			isUniform = NO;
+			break;
+		}
+	}
+	if (isUniform && (count == 1)) {
+		return [ZIMSqlCondition comparison: [ZIMSqlCondition column: [[_orderKeys objectAtIndex: 0] objectAtIndex: 0]] operator: (descending ? ZIMSqlOperatorLessThan : ZIMSqlOperatorGreaterThan) operand: [ZIMSqlCondition bind: [_cursor objectAtIndex: 0]]];
+	}
+	if (isUniform && (ZIMSqlLibraryVersion() >= 3015000)) { // i.e. row values were added in SQLite 3.15.0
+		NSMutableArray *columns = [[NSMutableArray alloc] initWithCapacity: count];
+		for (NSArray *orderKey in _orderKeys) {
+			[columns addObject: [ZIMSqlCondition column: [orderKey objectAtIndex: 0]]];
+		}
+		return [ZIMSqlCondition comparison: [ZIMSqlCondition list: columns] operator: (descending ? ZIMSqlOperatorLessThan : ZIMSqlOperatorGreaterThan) operand: [ZIMSqlCondition list: _cursor]];
+	}
+	// (a > ?) OR (a = ? AND b > ?) OR ..., where a NULL is matched with IS NULL and is followed by IS NOT NULL
+	ZIMSqlCondition *null = [ZIMSqlCondition literal: [NSNull null]];
+	ZIMSqlCondition *condition = [ZIMSqlCondition group];
+	for (NSUInteger i = 0; i < count; i++) {
+		NSArray *orderKey = [_orderKeys objectAtIndex: i];
+		ZIMSqlCondition *column = [ZIMSqlCondition column: [orderKey objectAtIndex: 0]];
+		id value = [_cursor objectAtIndex: i];
+		BOOL isNull = [value isKindOfClass: [NSNull class]];
+		BOOL nullsFirst = [self areNullsFirst: orderKey];
+		if (isNull && !nullsFirst) { // i.e. nothing follows a NULL that sorts last
+			continue;
+		}
+		[condition block: ZIMSqlEnclosureOpeningBrace connector: ZIMSqlConnectorOr];
+		for (NSUInteger j = 0; j < i; j++) {
+			id prefix = [_cursor objectAtIndex: j];
+			if ([prefix isKindOfClass: [NSNull class]]) {
+				[condition addCondition: [ZIMSqlCondition comparison: [ZIMSqlCondition column: [[_orderKeys objectAtIndex: j] objectAtIndex: 0]] operator: ZIMSqlOperatorIs operand: null] connector: ZIMSqlConnectorAnd];
+			}
+			else {
+				[condition addCondition: [ZIMSqlCondition comparison: [ZIMSqlCondition column: [[_orderKeys objectAtIndex: j] objectAtIndex: 0]] operator: ZIMSqlOperatorEqualTo operand: [ZIMSqlCondition bind: prefix]] connector: ZIMSqlConnectorAnd];
+			}
+		}
+		NSString *operator = [[orderKey objectAtIndex: 2] boolValue] ? ZIMSqlOperatorLessThan : ZIMSqlOperatorGreaterThan;
+		if (isNull) {
+			[condition addCondition: [ZIMSqlCondition comparison: column operator: ZIMSqlOperatorIsNot operand: null] connector: ZIMSqlConnectorAnd];
+		}
+		else if (nullsFirst) {
+			[condition addCondition: [ZIMSqlCondition comparison: column operator: operator operand: [ZIMSqlCondition bind: value]] connector: ZIMSqlConnectorAnd];
+		}
+		else {
+			[condition block: ZIMSqlEnclosureOpeningBrace connector: ZIMSqlConnectorAnd];
+			[condition addCondition: [ZIMSqlCondition comparison: column operator: operator operand: [ZIMSqlCondition bind: value]] connector: ZIMSqlConnectorAnd];
+			[condition addCondition: [ZIMSqlCondition comparison: column operator: ZIMSqlOperatorIs operand: null] connector: ZIMSqlConnectorOr];
+			[condition block: ZIMSqlEnclosureClosingBrace connector: ZIMSqlConnectorAnd];
+		}
+		[condition block: ZIMSqlEnclosureClosingBrace connector: ZIMSqlConnectorAnd];
+	}
+	if ([condition isEmpty]) { // i.e. the cursor is already at the end
+		return [ZIMSqlCondition literal: [NSNumber numberWithInt: 0]];
+	}
+	return condition;
+}
+
+- (BOOL) areNullsFirst: (NSArray *)orderKey {
+	NSString *weight = [orderKey objectAtIndex: 3];
+	if ([weight isEqualToString: ZIMSqlNullsFirst]) {
+		return YES;
+	}
+	if ([weight isEqualToString: ZIMSqlNullsLast]) {
+		return NO;
+	}
+	return ![[orderKey objectAtIndex: 2] boolValue]; // i.e. SQLite sorts NULLs as the smallest value
+}
+
 - (void) combine: (NSString *)statement operator: (NSString *)operator {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	if (_cursor != nil) { // i.e. the WHERE clause would only restrict the first select statement
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May not combine a select statement after declaring a cursor." userInfo: nil];
+	}
 	statement = [statement stringByTrimmingCharactersInSet: [NSCharacterSet characterSetWithCharactersInString: @" ;\n\r\t\f"]];
-	if (![statement matchRegex: @"^select .+$" options: NSRegularExpressionCaseInsensitive]) {
-		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only combine a select statement." userInfo: nil];
+	if (([statement length] > 5) && ([statement compare: @"WITH " options: NSCaseInsensitiveSearch range: NSMakeRange(0, 5)] == NSOrderedSame)) {
+		statement = [NSString stringWithFormat: @"SELECT * FROM (%@)", statement]; // i.e. a "WITH" clause may only begin the compound select statement, so it is moved into a subquery
+	}
+	else if (!(([statement length] > 7) && ([statement compare: @"SELECT " options: NSCaseInsensitiveSearch range: NSMakeRange(0, 7)] == NSOrderedSame))) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"May only combine a select statement, which may begin with a \"WITH\" clause." userInfo: nil];
 	}
 	[_combine addObject: [NSString stringWithFormat: @"%@ %@", [ZIMSqlExpression prepareOperator: operator ofType: @"SET"], statement]];
 }
 
+- (id) copyWithZone: (NSZone *)zone {
+	ZIMSqlSelectStatement *copy = [[[self class] allocWithZone: zone] init];
+	for (NSArray *with in _with) {
+		[copy->_with addObject: [NSArray arrayWithObjects: [with objectAtIndex: 0], [[with objectAtIndex: 1] copyWithZone: zone], nil]];
+	}
+	copy->_recursive = _recursive;
+	copy->_distinct = _distinct;
+	copy->_forceJoinOrder = _forceJoinOrder;
+	[copy->_column addObjectsFromArray: _column];
+	[copy->_table addObjectsFromArray: _table];
+	for (NSArray *join in _join) {
+		[copy->_join addObject: [NSArray arrayWithObjects: [join objectAtIndex: 0], [[join objectAtIndex: 1] copyWithZone: zone], [[join objectAtIndex: 2] mutableCopyWithZone: zone], nil]];
+	}
+	copy->_where = [_where copyWithZone: zone];
+	[copy->_groupBy addObjectsFromArray: _groupBy];
+	copy->_having = [_having copyWithZone: zone];
+	for (NSArray *definition in _window) {
+		[copy->_window addObject: [NSMutableArray arrayWithObjects: [definition objectAtIndex: 0], [[definition objectAtIndex: 1] mutableCopyWithZone: zone], [[definition objectAtIndex: 2] mutableCopyWithZone: zone], [definition objectAtIndex: 3], nil]];
+	}
+	[copy->_orderBy addObjectsFromArray: _orderBy];
+	[copy->_orderKeys addObjectsFromArray: _orderKeys];
+	copy->_cursor = _cursor;
+	copy->_limit = _limit;
+	copy->_offset = _offset;
+	[copy->_combine addObjectsFromArray: _combine];
+	copy->_statement = _statement;
+	copy->_parameterizedStatement = _parameterizedStatement;
+	copy->_parameters = _parameters;
+	copy->_temporaryTables = _temporaryTables;
+	return copy;
+}
+
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	if (_statement == nil) {
+		_statement = [self statementWithParameters: nil];
+	}
+	return _statement;
+}
+
+- (NSString *) parameterizedStatement {
+	if (_parameterizedStatement == nil) {
+		NSMutableArray *parameters = [[NSMutableArray alloc] init];
+		_temporaryTables = [[NSMutableDictionary alloc] init];
+		_parameterizedStatement = [self statementWithParameters: parameters];
+		_parameters = parameters;
+	}
+	return _parameterizedStatement;
+}
+
+- (NSArray *) parameters {
+	[self parameterizedStatement];
+	return _parameters;
+}
+
+- (NSDictionary *) temporaryTables {
+	[self parameterizedStatement];
+	return _temporaryTables;
+}
+
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters {
+	// Reserves enough space for a typical statement up front so that the buffer seldom grows
+	NSUInteger capacity = 128 + 32 * ([_with count] * 4 + [_column count] + [_table count] + [_join count] + [_where count] + [_groupBy count] + [_having count] + [_window count] + [_orderBy count] + [_combine count]);
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: capacity];
+	NSMutableDictionary *tables = (parameters != nil) ? _temporaryTables : nil;
 	
-	[sql appendString: @"SELECT "];
+	if ([_with count] > 0) {
+		[sql appendCString: (_recursive) ? "WITH RECURSIVE " : "WITH "];
+		int i = 0;
+		for (NSArray *with in _with) {
+			if (i > 0) {
+				[sql appendCString: ", "];
+			}
+			ZIMSqlSelectStatement *subquery = [with objectAtIndex: 1];
+			NSString *statement = (parameters != nil) ? [subquery parameterizedStatement] : [subquery statement];
+			[sql appendString: [with objectAtIndex: 0]];
+			[sql appendCString: " AS ("];
+			[sql appendString: [statement substringToIndex: [statement length] - 1]];
+			[sql appendCString: ") "];
+			if (parameters != nil) {
+				[parameters addObjectsFromArray: [subquery parameters]];
+				[tables addEntriesFromDictionary: [subquery temporaryTables]];
+			}
+			i++;
+		}
+	}
+
+	[sql appendCString: "SELECT "];
 	
 	if (_distinct) {
-		[sql appendString: @"DISTINCT "];
+		[sql appendCString: "DISTINCT "];
 	}
 	
 	if ([_column count] > 0) {
-		[sql appendString: [_column componentsJoinedByString: @", "]];
+		int i = 0;
+		for (id column in _column) {
+			if (i > 0) {
+				[sql appendCString: ", "];
+			}
+			if ([column isKindOfClass: [NSArray class]]) {
+				[sql appendString: [column objectAtIndex: 0]];
+				[[column objectAtIndex: 1] appendToWriter: sql parameters: parameters temporaryTables: tables];
+				[sql appendString: [column objectAtIndex: 2]];
+			}
+			else {
+				[sql appendString: column];
+			}
+			i++;
+		}
 	}
 	else {
-		[sql appendString: @"*"];
+		[sql appendBytes: "*" length: 1];
 	}
 	
 	if ([_table count] > 0) {
-		[sql appendString: @" FROM "];
-		[sql appendString: [_table componentsJoinedByString: @", "]];
+		[sql appendCString: " FROM "];
+		[sql appendStrings: _table separator: (_forceJoinOrder) ? " CROSS JOIN " : ", "];
 	}
 
 	for (NSArray *join in _join) {
-		[sql appendFormat: @" %@", [join objectAtIndex: 0]];
-		NSArray *joinCondition = (NSArray *)[join objectAtIndex: 1];
-		if ([joinCondition count] > 0) {
-            [sql appendString: @" ON ("];
-            int i = 0;
-            for (NSArray *joinParts in joinCondition) {
-                NSString *onClause = [joinParts objectAtIndex: 1];
-                if (i > 0) {
-                    [sql appendFormat: @" %@ ", [joinParts objectAtIndex: 0]];
-                }
-                [sql appendString: onClause];
-                i++;
-            }
-            [sql appendString: @")"];
+		NSString *joinText = [join objectAtIndex: 0];
+		[sql appendBytes: " " length: 1];
+		if (_forceJoinOrder && [joinText hasPrefix: @"INNER JOIN "]) {
+			// Note: SQLite treats "CROSS JOIN" as an inner join whose left table is always the outer loop.
+			[sql appendCString: "CROSS JOIN "];
+			[sql appendString: [joinText substringFromIndex: 11]];
 		}
 		else {
-			joinCondition = (NSArray *)[join objectAtIndex: 2];
-			if ([joinCondition count] > 0) {
-				[sql appendFormat: @" USING %@", [joinCondition componentsJoinedByString: @", "]];
+			[sql appendString: joinText];
+		}
+		ZIMSqlCondition *joinCondition = (ZIMSqlCondition *)[join objectAtIndex: 1];
+		if (![joinCondition isEmpty]) {
+			[sql appendCString: " ON ("];
+			[joinCondition appendToWriter: sql parameters: parameters temporaryTables: tables];
+			[sql appendBytes: ")" length: 1];
+		}
+		else {
+			NSArray *joinColumns = (NSArray *)[join objectAtIndex: 2];
+			if ([joinColumns count] > 0) {
+				[sql appendCString: " USING "];
+				[sql appendStrings: joinColumns separator: ", "];
 			}
 		}
 	}
 
-	if ([_where count] > 0) {
-		BOOL doAppendConnector = NO;
-		[sql appendString: @" WHERE "];
-		for (NSArray *where in _where) {
-			NSString *whereClause = [where objectAtIndex: 1];
-			if (doAppendConnector && ![whereClause isEqualToString: ZIMSqlEnclosureClosingBrace]) {
-				[sql appendFormat: @" %@ ", [where objectAtIndex: 0]];
-			}
-			[sql appendString: whereClause];
-			doAppendConnector = (![whereClause isEqualToString: ZIMSqlEnclosureOpeningBrace]);
+	ZIMSqlCondition *seek = [self seekCondition];
+	if (![_where isEmpty]) {
+		[sql appendCString: " WHERE "];
+		if (seek != nil) {
+			[sql appendBytes: "(" length: 1];
+			[_where appendToWriter: sql parameters: parameters temporaryTables: tables];
+			[sql appendCString: ") AND ("];
+			[seek appendToWriter: sql parameters: parameters temporaryTables: tables];
+			[sql appendBytes: ")" length: 1];
 		}
+		else {
+			[_where appendToWriter: sql parameters: parameters temporaryTables: tables];
+		}
+	}
+	else if (seek != nil) {
+		[sql appendCString: " WHERE "];
+		[seek appendToWriter: sql parameters: parameters temporaryTables: tables];
 	}
 
 	if ([_groupBy count] > 0) {
-		[sql appendFormat: @" GROUP BY %@", [_groupBy componentsJoinedByString: @", "]];
+		[sql appendCString: " GROUP BY "];
+		[sql appendStrings: _groupBy separator: ", "];
+	}
+	
+	if (![_having isEmpty]) {
+		[sql appendCString: " HAVING "];
+		[_having appendToWriter: sql parameters: parameters temporaryTables: tables];
 	}
 	
-	if ([_having count] > 0) {
-		BOOL doAppendConnector = NO;
-		[sql appendString: @" HAVING "];
-		for (NSArray *having in _having) {
-			NSString *havingClause = [having objectAtIndex: 1];
-			if (doAppendConnector && ![havingClause isEqualToString: ZIMSqlEnclosureClosingBrace]) {
-				[sql appendFormat: @" %@ ", [having objectAtIndex: 0]];
+	if ([_window count] > 0) {
+		[sql appendCString: " WINDOW "];
+		int i = 0;
+		for (NSArray *definition in _window) {
+			if (i > 0) {
+				[sql appendCString: ", "];
 			}
-			[sql appendString: havingClause];
-			doAppendConnector = (![havingClause isEqualToString: ZIMSqlEnclosureOpeningBrace]);
+			[sql appendString: [definition objectAtIndex: 0]];
+			[sql appendCString: " AS ("];
+			NSArray *partitions = [definition objectAtIndex: 1];
+			NSArray *orderings = [definition objectAtIndex: 2];
+			NSString *frame = [definition objectAtIndex: 3];
+			BOOL doAppendSpace = NO;
+			if ([partitions count] > 0) {
+				[sql appendCString: "PARTITION BY "];
+				[sql appendStrings: partitions separator: ", "];
+				doAppendSpace = YES;
+			}
+			if ([orderings count] > 0) {
+				[sql appendCString: (doAppendSpace) ? " ORDER BY " : "ORDER BY "];
+				[sql appendStrings: orderings separator: ", "];
+				doAppendSpace = YES;
+			}
+			if ([frame length] > 0) {
+				if (doAppendSpace) {
+					[sql appendBytes: " " length: 1];
+				}
+				[sql appendString: frame];
+			}
+			[sql appendBytes: ")" length: 1];
+			i++;
 		}
 	}
-	
+
 	if ([_orderBy count] > 0) {
-		[sql appendFormat: @" ORDER BY %@", [_orderBy componentsJoinedByString: @", "]];
+		[sql appendCString: " ORDER BY "];
+		[sql appendStrings: _orderBy separator: ", "];
 	}
 	
 	if (_limit > 0) {
-		[sql appendFormat: @" LIMIT %d", _limit];
+		[sql appendCString: " LIMIT "];
+		[sql appendInteger: _limit];
 	}
 
 	if (_offset > 0) {
-		[sql appendFormat: @" OFFSET %d", _offset];
+		[sql appendCString: " OFFSET "];
+		[sql appendInteger: _offset];
 	}
 
 	for (NSString *combine in _combine) {
-		[sql appendFormat: @" %@", combine];
+		[sql appendBytes: " " length: 1];
+		[sql appendString: combine];
 	}
 
-	[sql appendString: @";"];
+	[sql appendBytes: ";" length: 1];
+
+	return [sql string];
+}
 
-	return sql;
+- (NSMutableArray *) windowNamed: (NSString *)name {
+	NSString *window = [ZIMSqlExpression prepareIdentifier: name maxCount: 1];
+	for (NSMutableArray *definition in _window) {
+		if ([[definition objectAtIndex: 0] isEqualToString: window]) {
+			return definition;
+		}
+	}
+	NSMutableArray *definition = [NSMutableArray arrayWithObjects: window, [[NSMutableArray alloc] init], [[NSMutableArray alloc] init], @"", nil];
+	[_window addObject: definition];
+	return definition;
 }
 
 @end
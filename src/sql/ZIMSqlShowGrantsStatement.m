@@ -42,9 +42,9 @@
 
 // GRANTEE | TABLE_CATALOG | PRIVILEGE_TYPE | IS_GRANTABLE
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 2048];
 
-	[sql appendString: @"SELECT * FROM ("];
+	[sql appendCString: "SELECT * FROM ("];
 
 	int index = 0;
 	for (NSString *dataSource in _plist) {
@@ -85,21 +85,23 @@
 
 			for (NSString *type in types) {
 				if (index > 0) {
-					[sql appendString: @" UNION ALL "];
+					[sql appendCString: " UNION ALL "];
 				}
-				[sql appendString: @"SELECT"];
+				[sql appendCString: "SELECT"];
 				[sql appendString: grantee];
 				[sql appendString: catalog];
-				[sql appendFormat: @" '%@' AS [PRIVILEGE_TYPE],", type];
+				[sql appendCString: " "];
+				[sql appendQuotedString: type];
+				[sql appendCString: " AS [PRIVILEGE_TYPE],"];
 				[sql appendString: grantable];
 				index++;
 			}
 		}
 	}
 
-	[sql appendString: @") ORDER BY [GRANTEE], [PRIVILEGE_TYPE];"];
+	[sql appendCString: ") ORDER BY [GRANTEE], [PRIVILEGE_TYPE];"];
 
-	return sql;
+	return [sql string];
 }
 
 @end
@@ -14,7 +14,6 @@
  * limitations under the License.
  */
 
-#import "NSString+ZIMString.h"
 #import "ZIMSqlShowTablesStatement.h"
 
 @implementation ZIMSqlShowTablesStatement
@@ -35,7 +34,7 @@
 	else if ([type isEqualToString: ZIMSqlShowTypePermanent]) {
 		_from = @"[sqlite_master]";
 	}
-	else if ([type matchRegex: @"^temp(orary)?$" options: NSRegularExpressionCaseInsensitive]) {
+	else if ((([type caseInsensitiveCompare: @"TEMP"] == NSOrderedSame) || ([type caseInsensitiveCompare: @"TEMPORARY"] == NSOrderedSame))) {
 		_from = @"[sqlite_temp_master]";
 	}
 	else {
@@ -48,23 +47,25 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 128];
 
-	[sql appendString: @"SELECT [name]"];
+	[sql appendCString: "SELECT [name]"];
 
-	[sql appendFormat: @" FROM %@", _from];
+	[sql appendCString: " FROM "];
+	[sql appendString: _from];
 
-	[sql appendString: @" WHERE [type] = 'table' AND [name] NOT LIKE 'sqlite_%'"];
+	[sql appendCString: " WHERE [type] = 'table' AND [name] NOT LIKE 'sqlite_%'"];
 
 	if (_like != nil) {
-		[sql appendFormat: @" AND %@", _like];
+		[sql appendCString: " AND "];
+		[sql appendString: _like];
 	}
 
-	[sql appendString: @" ORDER BY [name] ASC"];
+	[sql appendCString: " ORDER BY [name] ASC"];
 
-	[sql appendString: @";"];
+	[sql appendCString: ";"];
 	
-	return sql;
+	return [sql string];
 }
 
 @end
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <Foundation/Foundation.h>
+
+/*!
+ @class					ZIMSqlStatementSplitter
+ @discussion			This class splits an SQL script into its statements, one statement at a time, so
+						that a script of any size can be run without holding it in memory as one string.  The
+						script is read from a memory-mapped file or from a file descriptor, and only the bytes
+						of the current statement are kept.  Statements are split at each terminal (i.e. ";")
+						that is not inside a literal, a quoted identifier, a comment, or the body of a
+						"CREATE TRIGGER ... BEGIN ... END" statement.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/complete.html
+ */
+@interface ZIMSqlStatementSplitter : NSObject {
+
+	@protected
+		NSData *_data;
+		NSMutableData *_buffer;
+		int _fileDescriptor;
+		const char *_bytes;
+		NSUInteger _length;
+		NSUInteger _position;
+		unsigned long long _offset;
+		unsigned long long _size;
+		BOOL _isEOF;
+		NSUInteger _count;
+
+}
+/*!
+ @method				initWithData:
+ @discussion			This constructor creates an instance of this class that will split the specified
+						UTF-8 encoded script.
+ @param data			The script to be split.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithData: (NSData *)data;
+/*!
+ @method				initWithContentsOfFile:
+ @discussion			This constructor creates an instance of this class that will split the script in
+						the specified file.  The file is memory-mapped, so its pages are only read as the
+						script is split.
+ @param path			The path to the script.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithContentsOfFile: (NSString *)path;
+/*!
+ @method				initWithFileDescriptor:
+ @discussion			This constructor creates an instance of this class that will split the script that
+						is read from the specified file descriptor (e.g. a pipe).  The file descriptor is
+						not closed by this class.
+ @param fileDescriptor	The file descriptor to be read.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithFileDescriptor: (int)fileDescriptor;
+/*!
+ @method				nextStatement
+ @discussion			This method will return the next statement in the script.  Leading whitespace and
+						comments are skipped, and empty statements are ignored.
+ @return				The next statement (i.e. nil once the script has been split).
+ @updated				2026-10-19
+ */
+- (NSString *) nextStatement;
+/*!
+ @method				count
+ @discussion			This method will return the number of statements that have been returned.
+ @return				The number of statements that have been returned.
+ @updated				2026-10-19
+ */
+- (NSUInteger) count;
+/*!
+ @method				offset
+ @discussion			This method will return the number of bytes of the script that have been split.
+ @return				The number of bytes that have been split.
+ @updated				2026-10-19
+ */
+- (unsigned long long) offset;
+/*!
+ @method				size
+ @discussion			This method will return the size of the script.
+ @return				The number of bytes in the script (i.e. 0 when the size is not known).
+ @updated				2026-10-19
+ */
+- (unsigned long long) size;
+
+@end
@@ -0,0 +1,295 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#import <errno.h>
+#import <sys/stat.h>
+#import <unistd.h>
+#import "ZIMSqlStatementSplitter.h"
+
+#define ZIMSqlStatementSplitterMaxWordLength 16 // i.e. long enough for "TEMPORARY"
+
+/*!
+ @category				ZIMSqlStatementSplitter (Private)
+ @discussion			This category defines the prototpes for this class's private methods.
+ @updated				2026-10-19
+ */
+@interface ZIMSqlStatementSplitter (Private)
+/*!
+ @method				fill:
+ @discussion			This method will discard the specified number of bytes from the front of the buffer
+						and then read the next chunk of the script from the file descriptor.
+ @param keep			The number of bytes to be discarded (i.e. the offset of the first byte to be kept).
+ @return				The number of bytes that were discarded.
+ @updated				2026-10-19
+ */
+- (NSUInteger) fill: (NSUInteger)keep;
+@end
+
+@implementation ZIMSqlStatementSplitter
+
+#if !defined(ZIMSqlStatementSplitterChunkSize)
+    #define ZIMSqlStatementSplitterChunkSize 65536 // Override this pre-processing instruction in your <project-name>_Prefix.pch
+#endif
+
+- (id) initWithData: (NSData *)data {
+	if ((self = [super init])) {
+		_data = data;
+		_buffer = nil;
+		_fileDescriptor = -1;
+		_bytes = (const char *)[data bytes];
+		_length = [data length];
+		_position = 0;
+		_offset = 0;
+		_size = _length;
+		_isEOF = YES;
+		_count = 0;
+		if ((_length >= 3) && (memcmp(_bytes, "\xEF\xBB\xBF", 3) == 0)) { // i.e. skips the UTF-8 byte order mark
+			_position = 3;
+		}
+	}
+	return self;
+}
+
+- (id) initWithContentsOfFile: (NSString *)path {
+	NSError *error = nil;
+	NSData *data = [NSData dataWithContentsOfFile: path options: NSDataReadingMappedAlways error: &error];
+	if (data == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Failed to map script. '%@'", [error localizedDescription]] userInfo: nil];
+	}
+	return [self initWithData: data];
+}
+
+- (id) initWithFileDescriptor: (int)fileDescriptor {
+	if ((self = [super init])) {
+		_data = nil;
+		_buffer = [[NSMutableData alloc] initWithCapacity: ZIMSqlStatementSplitterChunkSize];
+		_fileDescriptor = fileDescriptor;
+		_bytes = NULL;
+		_length = 0;
+		_position = 0;
+		_offset = 0;
+		struct stat info;
+		_size = ((fstat(fileDescriptor, &info) == 0) && S_ISREG(info.st_mode)) ? (unsigned long long)info.st_size : 0;
+		_isEOF = NO;
+		_count = 0;
+		while ((_length < 3) && !_isEOF) {
+			[self fill: 0];
+		}
+		if ((_length >= 3) && (memcmp(_bytes, "\xEF\xBB\xBF", 3) == 0)) { // i.e. skips the UTF-8 byte order mark
+			_position = 3;
+		}
+	}
+	return self;
+}
+
+- (NSString *) nextStatement {
+	NSInteger start = -1; // i.e. the first byte of the statement that is not whitespace or a comment
+	char quote = '\0'; // i.e. the closing quote of the current literal or quoted identifier
+	BOOL isLineComment = NO;
+	BOOL isBlockComment = NO;
+	char word[ZIMSqlStatementSplitterMaxWordLength + 1];
+	NSUInteger wordLength = 0;
+	BOOL isWord = NO;
+	NSUInteger words = 0;
+	BOOL isCreate = NO;
+	BOOL isTrigger = NO;
+	BOOL isBody = NO;
+	BOOL isEnd = NO;
+	NSUInteger depth = 0; // i.e. the number of open "CASE" expressions in a trigger's body
+
+	while (YES) {
+		if (((_length - _position) < 2) && !_isEOF) { // i.e. keeps a byte of lookahead
+			NSUInteger discarded = [self fill: (start >= 0) ? (NSUInteger)start : _position];
+			if (start >= 0) {
+				start -= (NSInteger)discarded;
+			}
+			continue;
+		}
+		if (_position >= _length) {
+			break;
+		}
+
+		char ch = _bytes[_position];
+		char next = ((_position + 1) < _length) ? _bytes[_position + 1] : '\0';
+
+		if (isWord) {
+			if (isalnum((unsigned char)ch) || (ch == '_') || ((unsigned char)ch >= 0x80)) {
+				if (wordLength < ZIMSqlStatementSplitterMaxWordLength) {
+					word[wordLength] = (char)toupper((unsigned char)ch);
+				}
+				wordLength++;
+				_position++;
+				continue;
+			}
+			isWord = NO;
+			word[(wordLength <= ZIMSqlStatementSplitterMaxWordLength) ? wordLength : 0] = '\0';
+			words++;
+			if (words == 1) {
+				isCreate = (strcmp(word, "CREATE") == 0);
+			}
+			else if (isCreate && !isTrigger) {
+				if (strcmp(word, "TRIGGER") == 0) {
+					isTrigger = YES;
+				}
+				else if ((strcmp(word, "TEMP") != 0) && (strcmp(word, "TEMPORARY") != 0)) {
+					isCreate = NO;
+				}
+			}
+			else if (isTrigger) {
+				if (!isBody) {
+					isBody = (strcmp(word, "BEGIN") == 0);
+				}
+				else if (strcmp(word, "CASE") == 0) {
+					depth++;
+				}
+				else if (strcmp(word, "END") == 0) {
+					if (depth > 0) {
+						depth--;
+					}
+					else {
+						isEnd = YES;
+						continue; // i.e. only whitespace and comments may come between "END" and ";"
+					}
+				}
+			}
+			isEnd = NO;
+		}
+
+		if (isLineComment) {
+			if ((ch == '\n') || (ch == '\r')) {
+				isLineComment = NO;
+			}
+			_position++;
+			continue;
+		}
+		if (isBlockComment) {
+			if ((ch == '*') && (next == '/')) {
+				isBlockComment = NO;
+				_position += 2;
+			}
+			else {
+				_position++;
+			}
+			continue;
+		}
+		if (quote != '\0') {
+			if (ch == quote) {
+				if ((quote != ']') && (next == quote)) { // i.e. an escaped quote
+					_position += 2;
+					continue;
+				}
+				quote = '\0';
+			}
+			_position++;
+			continue;
+		}
+
+		if (((ch == '-') && (next == '-')) || (ch == '#')) { // i.e. SQL-style and MySQL-style comments
+			isLineComment = YES;
+			_position++;
+			continue;
+		}
+		if ((ch == '/') && (next == '*')) { // i.e. C-style comment
+			isBlockComment = YES;
+			_position += 2;
+			continue;
+		}
+		if (isspace((unsigned char)ch)) {
+			_position++;
+			continue;
+		}
+		if (ch == ';') {
+			if (start < 0) { // i.e. an empty statement
+				_position++;
+				continue;
+			}
+			if (!isTrigger || isEnd) {
+				_position++;
+				NSString *statement = [[NSString alloc] initWithBytes: _bytes + start length: _position - (NSUInteger)start encoding: NSUTF8StringEncoding];
+				if (statement == nil) {
+					@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Failed to decode statement as UTF-8." userInfo: nil];
+				}
+				_count++;
+				return statement;
+			}
+		}
+		if (start < 0) {
+			start = (NSInteger)_position;
+		}
+		isEnd = NO;
+		if ((ch == '\'') || (ch == '"') || (ch == '`')) {
+			quote = ch;
+		}
+		else if (ch == '[') {
+			quote = ']';
+		}
+		else if (isalpha((unsigned char)ch) || (ch == '_') || ((unsigned char)ch >= 0x80)) {
+			isWord = YES;
+			word[0] = (char)toupper((unsigned char)ch);
+			wordLength = 1;
+		}
+		_position++;
+	}
+
+	if (start < 0) {
+		return nil;
+	}
+	NSString *statement = [[NSString alloc] initWithBytes: _bytes + start length: _length - (NSUInteger)start encoding: NSUTF8StringEncoding];
+	if (statement == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Failed to decode statement as UTF-8." userInfo: nil];
+	}
+	_count++;
+	return [statement stringByTrimmingCharactersInSet: [NSCharacterSet whitespaceAndNewlineCharacterSet]];
+}
+
+- (NSUInteger) count {
+	return _count;
+}
+
+- (unsigned long long) offset {
+	return _offset + _position;
+}
+
+- (unsigned long long) size {
+	return _size;
+}
+
+- (NSUInteger) fill: (NSUInteger)keep {
+	if (_isEOF) {
+		return 0;
+	}
+	if (keep > 0) {
+		[_buffer replaceBytesInRange: NSMakeRange(0, keep) withBytes: NULL length: 0];
+		_offset += keep;
+		_position -= keep;
+	}
+	NSUInteger length = [_buffer length];
+	[_buffer setLength: length + ZIMSqlStatementSplitterChunkSize];
+	ssize_t count;
+	do {
+		count = read(_fileDescriptor, (char *)[_buffer mutableBytes] + length, ZIMSqlStatementSplitterChunkSize);
+	} while ((count < 0) && (errno == EINTR));
+	int error = errno;
+	[_buffer setLength: length + ((count > 0) ? (NSUInteger)count : 0)];
+	_bytes = (const char *)[_buffer bytes];
+	_length = [_buffer length];
+	if (count < 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Failed to read script. '%s'", strerror(error)] userInfo: nil];
+	}
+	_isEOF = (count == 0);
+	return keep;
+}
+
+@end
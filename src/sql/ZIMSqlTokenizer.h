@@ -28,15 +28,54 @@
 #define ZIMSqlTokenTerminal						@"TERMINAL"
 #define ZIMSqlTokenWhitespace					@"WHITESPACE"
 
+/*!
+ @typedef				ZIMSqlTokenType
+ @discussion			This enumeration defines the type of a token.  A token of type ZIMSqlTokenTypeCharacter
+						(e.g. a parenthesis or a comma) is its own type.
+ @updated				2026-10-19
+ */
+typedef enum {
+	ZIMSqlTokenTypeError = 0,
+	ZIMSqlTokenTypeHexadecimal,
+	ZIMSqlTokenTypeIdentifier,
+	ZIMSqlTokenTypeInteger,
+	ZIMSqlTokenTypeKeyword,
+	ZIMSqlTokenTypeLiteral,
+	ZIMSqlTokenTypeOperator,
+	ZIMSqlTokenTypeParameter,
+	ZIMSqlTokenTypeReal,
+	ZIMSqlTokenTypeTerminal,
+	ZIMSqlTokenTypeWhitespace,
+	ZIMSqlTokenTypeCharacter
+} ZIMSqlTokenType;
+
+/*!
+ @typedef				ZIMSqlToken
+ @discussion			This structure records a token as a range of the tokenizer's UTF-8 buffer.
+ @updated				2026-10-19
+ */
+typedef struct {
+	ZIMSqlTokenType type;
+	NSUInteger offset;
+	NSUInteger length;
+} ZIMSqlToken;
+
 /*!
  @class					ZIMSqlTokenizer
- @discussion			This class tokenizes an SQL statement.
- @updated				2011-11-03
+ @discussion			This class tokenizes an SQL statement.  Tokens are stored as a packed array of records
+						over a copy of the statement's UTF-8 bytes, and a token's string is only created when
+						it is accessed.
+ @updated				2026-10-19
  @see					http://www.opensource.apple.com/source/SQLite/SQLite-74/public_source/src/complete.c
  */
 @interface ZIMSqlTokenizer : NSObject <NSFastEnumeration, ZIMSqlStatement> {
 
 	@protected
+		char *_buffer;
+		NSUInteger _size;
+		ZIMSqlToken *_tokens;
+		NSUInteger _count;
+		NSUInteger _capacity;
 		NSMutableArray *_tuples;
 
 }
@@ -51,10 +90,12 @@
 - (id) initWithSqlStatement: (NSString *)sql;
 /*!
  @method				objectAtIndex:
- @discussion			This method returns the object located at index.
+ @discussion			This method returns the object located at index.  The tuple is created on first
+						access; tokenAtIndex:, typeAtIndex:, and stringAtIndex: should be preferred when
+						scanning many tokens.
  @param index			An index within the bounds of the array.
  @return				A dictionary representing the tuple.
- @updated				2011-07-13
+ @updated				2026-10-19
  */
 - (id) objectAtIndex: (NSUInteger)index;
 /*!
@@ -64,6 +105,37 @@
  @updated				2011-07-13
  */
 - (NSUInteger) count;
+/*!
+ @method				tokenAtIndex:
+ @discussion			This method returns the record of the token located at index.
+ @param index			An index within the bounds of the array.
+ @return				The token's record.
+ @updated				2026-10-19
+ */
+- (ZIMSqlToken) tokenAtIndex: (NSUInteger)index;
+/*!
+ @method				typeAtIndex:
+ @discussion			This method returns the type of the token located at index.
+ @param index			An index within the bounds of the array.
+ @return				The token's type (e.g. ZIMSqlTokenKeyword).
+ @updated				2026-10-19
+ */
+- (NSString *) typeAtIndex: (NSUInteger)index;
+/*!
+ @method				stringAtIndex:
+ @discussion			This method returns the token located at index.
+ @param index			An index within the bounds of the array.
+ @return				The token.
+ @updated				2026-10-19
+ */
+- (NSString *) stringAtIndex: (NSUInteger)index;
+/*!
+ @method				UTF8String
+ @discussion			This method returns the UTF-8 buffer over which the tokens are recorded.
+ @return				The NUL-terminated UTF-8 buffer.
+ @updated				2026-10-19
+ */
+- (const char *) UTF8String;
 /*!
  @method				statement
  @discussion			This method will return the SQL statement.
@@ -16,133 +16,139 @@
 
 #import "ZIMSqlTokenizer.h"
 
-@implementation ZIMSqlTokenizer
+#define ZIMSqlTokenizerMaxKeywordLength 25 // i.e. the length of "SQLITE_COMPILEOPTION_USED"
 
-static NSSet *_keywords = nil;
+/*
+ * @see http://www.sqlite.org/lang_keywords.html
+ * @see http://www.sqlite.org/lang_corefunc.html
+ * @see http://www.sqlite.org/lang_datefunc.html
+ * @see http://www.sqlite.org/lang_aggfunc.html
+ * @see http://cpan.uwinnipeg.ca/htdocs/SQL-ReservedWords/SQL/ReservedWords/SQLite.pm.html
+ */
+static const char *ZIMSqlKeywords[] = { // Note: Must remain sorted for bsearch()
+	"ABORT", "ABS", "ACTION", "ADD", "AFTER", "ALL", "ALTER", "ANALYZE", "AND", "AS", "ASC", "ATTACH", "AUTOINCREMENT",
+	"AVG", "BEFORE", "BEGIN", "BETWEEN", "BY", "CASCADE", "CASE", "CAST", "CHANGES", "CHECK", "COALESCE", "COLLATE",
+	"COLUMN", "COMMIT", "CONFLICT", "CONSTRAINT", "COUNT", "CREATE", "CROSS", "CURRENT_DATE", "CURRENT_TIME",
+	"CURRENT_TIMESTAMP", "DATABASE", "DATE", "DATETIME", "DEFAULT", "DEFERRABLE", "DEFERRED", "DELETE", "DESC", "DETACH",
+	"DISTINCT", "DROP", "EACH", "ELSE", "END", "ESCAPE", "EXCEPT", "EXCLUSIVE", "EXISTS", "EXPLAIN", "FAIL", "FOR",
+	"FOREIGN", "FROM", "FULL", "GLOB", "GROUP", "GROUP_CONCAT", "HAVING", "HEX", "IF", "IFNULL", "IGNORE", "IMMEDIATE",
+	"IN", "INDEX", "INDEXED", "INITIALLY", "INNER", "INSERT", "INSTEAD", "INTERSECT", "INTO", "IS", "ISNULL", "JOIN",
+	"JULIANDAY", "KEY", "LAST_INSERT_ROWID", "LEFT", "LENGTH", "LIKE", "LIMIT", "LOAD_EXTENSION", "LOWER", "LTRIM",
+	"MATCH", "MAX", "MIN", "NATURAL", "NO", "NOT", "NOTNULL", "NULL", "NULLIF", "OF", "OFFSET", "ON", "OR", "ORDER",
+	"OUTER", "PLAN", "PRAGMA", "PRIMARY", "QUERY", "QUOTE", "RAISE", "RANDOM", "RANDOMBLOB", "REFERENCES", "REGEXP",
+	"REINDEX", "RELEASE", "RENAME", "REPLACE", "RESTRICT", "RIGHT", "ROLLBACK", "ROUND", "ROW", "RTRIM", "SAVEPOINT",
+	"SELECT", "SET", "SOUNDEX", "SQLITE_COMPILEOPTION_GET", "SQLITE_COMPILEOPTION_USED", "SQLITE_SOURCE_ID",
+	"SQLITE_VERSION", "STRFTIME", "SUBSTR", "SUM", "TABLE", "TEMP", "TEMPORARY", "THEN", "TIME", "TO", "TOTAL",
+	"TOTAL_CHANGES", "TRANSACTION", "TRIGGER", "TRIM", "TYPEOF", "UNION", "UNIQUE", "UPDATE", "UPPER", "USING", "VACUUM",
+	"VALUES", "VIEW", "VIRTUAL", "WHEN", "WHERE", "ZEROBLOB"
+};
+
+static int ZIMSqlTokenizerCompareKeywords(const void *key, const void *keyword) {
+	return strcmp(*(const char **)key, *(const char **)keyword);
+}
+
+static BOOL ZIMSqlTokenizerIsKeyword(const char *token, NSUInteger length) {
+	if ((length == 0) || (length > ZIMSqlTokenizerMaxKeywordLength)) {
+		return NO;
+	}
+	char buffer[ZIMSqlTokenizerMaxKeywordLength + 1];
+	for (NSUInteger i = 0; i < length; i++) {
+		buffer[i] = (char)toupper((unsigned char)token[i]);
+	}
+	buffer[length] = '\0';
+	const char *key = buffer;
+	return (bsearch(&key, ZIMSqlKeywords, sizeof(ZIMSqlKeywords) / sizeof(ZIMSqlKeywords[0]), sizeof(const char *), ZIMSqlTokenizerCompareKeywords) != NULL);
+}
+
+static void ZIMSqlTokenizerAppend(ZIMSqlToken **tokens, NSUInteger *count, NSUInteger *capacity, ZIMSqlTokenType type, NSUInteger offset, NSUInteger length) {
+	if (*count == *capacity) {
+		*capacity *= 2;
+		*tokens = (ZIMSqlToken *)realloc(*tokens, *capacity * sizeof(ZIMSqlToken));
+		if (*tokens == NULL) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Failed to allocate memory for tokens." userInfo: nil];
+		}
+	}
+	ZIMSqlToken *token = *tokens + *count;
+	token->type = type;
+	token->offset = offset;
+	token->length = length;
+	(*count)++;
+}
+
+@implementation ZIMSqlTokenizer
 
 - (id) initWithSqlStatement: (NSString *)sql {
 	if ((self = [super init])) {
-		_tuples = [[NSMutableArray alloc] init];
+		const char *utf8 = [sql UTF8String];
+		_size = (utf8 != NULL) ? strlen(utf8) : 0;
+		_buffer = (char *)malloc(_size + 1);
+		_capacity = (_size / 4) + 16;
+		_tokens = (ZIMSqlToken *)malloc(_capacity * sizeof(ZIMSqlToken));
+		_count = 0;
+		_tuples = nil;
+		if ((_buffer == NULL) || (_tokens == NULL)) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Failed to allocate memory for tokens." userInfo: nil];
+		}
+		memcpy(_buffer, (utf8 != NULL) ? utf8 : "", _size + 1);
 
-		const char *statement = [sql UTF8String];
-		int position = 0;
-		int length = strlen(statement) - 1;
+		const char *statement = _buffer;
+		NSInteger position = 0;
+		NSInteger length = (NSInteger)_size - 1;
 		
 		char whitespace[] = " \t";
 		char eol[] = "\r\n\f";
 		char quote[] = "`\"";
 		
 		while (position <= length) {
+			NSInteger start = position;
+			ZIMSqlTokenType type;
 			char ch = statement[position];
 			if (ch == '|') { // "operator" token
-				int lookahead = position + 1;
-				if ((lookahead <= length) && (statement[lookahead] == '|')) {
-					lookahead++;
-					int size = lookahead - position;
-					char token[size + 1];
-					strncpy(token, statement + position, size);
-					token[size] = '\0';
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%s", token);
-				}
-				else {
-					char token = ch;
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%c", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%c", token);
-				}
-				position = lookahead;
+				position += ((position + 1 <= length) && (statement[position + 1] == '|')) ? 2 : 1;
+				type = ZIMSqlTokenTypeOperator;
 			}
 			else if ((ch == '!') || (ch == '=')) { // "operator" token
-				int lookahead = position + 1;
-				if ((lookahead <= length) && (statement[lookahead] == '=')) {
-					lookahead++;
-					int size = lookahead - position;
-					char token[size + 1];
-					strncpy(token, statement + position, size);
-					token[size] = '\0';
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%s", token);
-				}
-				else {
-					char token = ch;
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%c", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%c", token);
-				}
-				position = lookahead;
+				position += ((position + 1 <= length) && (statement[position + 1] == '=')) ? 2 : 1;
+				type = ZIMSqlTokenTypeOperator;
 			}
 			else if ((ch == '<') || (ch == '>')) { // "operator" token
-				int lookahead = position + 1;
-				char next = statement[lookahead];
-				if ((next == '=') || (next == ch) || ((next == '>') && (ch == '<'))) {
-					lookahead++;
-					int size = lookahead - position;
-					char token[size + 1];
-					strncpy(token, statement + position, size);
-					token[size] = '\0';
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%s", token);
-				}
-				else {
-					char token = ch;
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%c", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%c", token);
-				}
-				position = lookahead;
+				char next = statement[position + 1];
+				position += ((next == '=') || (next == ch) || ((next == '>') && (ch == '<'))) ? 2 : 1;
+				type = ZIMSqlTokenTypeOperator;
 			}
 			else if ((strchr(whitespace, ch) != NULL) || (strchr(eol, ch) != NULL)) { // "whitespace" token
-				int start = position;
 				char next;
 				do {
 					position++;
 					next = statement[position];
 				} while((next != '\0') && ((strchr(whitespace, next) != NULL) || (strchr(eol, next) != NULL)));
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenWhitespace, @"type", nil]];
-				//NSLog(@"%s", token);
+				type = ZIMSqlTokenTypeWhitespace;
 			}
 			else if (ch == '#') { // "whitespace" token (i.e. MySQL-style comment)
-				int start = position;
 				do {
 					position++;
 				} while((position < length) && (strchr(eol, statement[position]) == NULL));
 				position++;
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenWhitespace, @"type", nil]];
-				//NSLog(@"%s", token);
+				type = ZIMSqlTokenTypeWhitespace;
 			}
 			else if (ch == '-') { // "whitespace" token (i.e. SQL-style comment) or "operator" token
-				int lookahead = position + 1;
+				NSInteger lookahead = position + 1;
 				if ((lookahead > length) || (statement[lookahead] != '-')) {
-					char token = ch;
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%c", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%c", token);
+					type = ZIMSqlTokenTypeOperator;
 				}
 				else {
 					while ((lookahead <= length) && (strchr(eol, statement[lookahead]) == NULL)) {
 						lookahead++;
 					}
 					lookahead++;
-					int size = lookahead - position;
-					char token[size + 1];
-					strncpy(token, statement + position, size);
-					token[size] = '\0';
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenWhitespace, @"type", nil]];
-					//NSLog(@"%s", token);
+					type = ZIMSqlTokenTypeWhitespace;
 				}
 				position = lookahead;
 			}
 			else if (ch == '/') { // "whitespace" token (i.e. C-style comment) or "operator" token
-				int lookahead = position + 1;
+				NSInteger lookahead = position + 1;
 				if ((lookahead > length) || (statement[lookahead] != '*')) {
-					char token = ch;
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%c", token], @"token", ZIMSqlTokenOperator, @"type", nil]];
-					//NSLog(@"%c", token);
+					type = ZIMSqlTokenTypeOperator;
 				}			
 				else {
 					lookahead += 2;
@@ -150,43 +156,26 @@ static NSSet *_keywords = nil;
 						lookahead++;
 					}
 					lookahead++;
-					int size = MIN(lookahead, length + 1) - position;
-					char token[size + 1];
-					strncpy(token, statement + position, size);
-					token[size] = '\0';
-					[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenWhitespace, @"type", nil]];
-					//NSLog(@"%s", token);
+					type = ZIMSqlTokenTypeWhitespace;
 				}
 				position = lookahead;
 			}
 			else if (ch == '[') { // "identifier" token (Microsoft-style)
-				int start = position;
 				do {
 					position++;
 				} while((position < length) && (statement[position] != ']'));
 				position++;
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenIdentifier, @"type", nil]];
-				//NSLog(@"%s", token);
+				type = ZIMSqlTokenTypeIdentifier;
 			}
 			else if (strchr(quote, ch) != NULL) { // "identifier" token (SQL-style)
-				int start = position;
 				do {
 					position++;
 				} while((position < length) && (statement[position] != ch));
 				position++;
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenIdentifier, @"type", nil]];
-				//NSLog(@"%s", token);
+				type = ZIMSqlTokenTypeIdentifier;
 			}
 			else if (ch == '\'') { // "literal" token
-				int lookahead = position + 1;
+				NSInteger lookahead = position + 1;
 				while (lookahead <= length) {
 					if (statement[lookahead] == '\'') {
 						if ((lookahead == length) || (statement[lookahead + 1] != '\'')) {
@@ -197,17 +186,10 @@ static NSSet *_keywords = nil;
 					}
 					lookahead++;
 				}
-				int size = lookahead - position;
-				char token[size + 1];
-				strncpy(token, statement + position, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", ZIMSqlTokenLiteral, @"type", nil]];
 				position = lookahead;
-				//NSLog(@"%s", token);
+				type = ZIMSqlTokenTypeLiteral;
 			}
 			else if ((ch >= '0') && (ch <= '9')) { // "integer" token, "real" token, or "hexadecimal" token
-				NSString *type;
-				int start = position;
 				char next;
 				if (ch == '0') {
 					position++;
@@ -216,18 +198,18 @@ static NSSet *_keywords = nil;
 						do {
 							position++;
 							next = statement[position];
-						} while ((next >= '0') && (next <= '9'));
-						type = ZIMSqlTokenHexadecimal;
+						} while (((next >= '0') && (next <= '9')) || ((next >= 'a') && (next <= 'f')) || ((next >= 'A') && (next <= 'F')));
+						type = ZIMSqlTokenTypeHexadecimal;
 					}
 					else if (next == '.') {
 						do {
 							position++;
 							next = statement[position];
 						} while ((next >= '0') && (next <= '9'));
-						type = ZIMSqlTokenReal;
+						type = ZIMSqlTokenTypeReal;
 					}
 					else {
-						type = ZIMSqlTokenInteger;
+						type = ZIMSqlTokenTypeInteger;
 					}
 				}
 				else {
@@ -240,79 +222,133 @@ static NSSet *_keywords = nil;
 							position++;
 							next = statement[position];
 						} while ((next >= '0') && (next <= '9'));
-						type = ZIMSqlTokenReal;
+						type = ZIMSqlTokenTypeReal;
 					}
 					else {
-						type = ZIMSqlTokenInteger;
+						type = ZIMSqlTokenTypeInteger;
 					}
 				}
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: [NSString stringWithFormat: @"%s", token], @"token", type, @"type", nil]];
-				//NSLog(@"%s", token);
 			}
 			else if (((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || (ch == '_')) { // "keyword" token or "identifier" token
-				int start = position;
 				char next;
 				do {
 					position++;
 					next = statement[position];
 				} while((position <= length) && (((next >= 'a') && (next <= 'z')) || ((next >= 'A') && (next <= 'Z')) || (next == '_') || ((next >= '0') && (next <= '9'))));
-				int size = position - start;
-				char token[size + 1];
-				strncpy(token, statement + start, size);
-				token[size] = '\0';
-				NSString *identifier = [NSString stringWithFormat: @"%s", token];
-				NSString *type = ([ZIMSqlTokenizer isKeyword: identifier]) ? ZIMSqlTokenKeyword : ZIMSqlTokenIdentifier;
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: identifier, @"token", type, @"type", nil]];
-				//NSLog(@"%s", token);
+				type = (ZIMSqlTokenizerIsKeyword(statement + start, (NSUInteger)(position - start))) ? ZIMSqlTokenTypeKeyword : ZIMSqlTokenTypeIdentifier;
+			}
+			else if ((unsigned char)ch >= 0x80) { // miscellaneous token (i.e. a multi-byte UTF-8 character)
+				do {
+					position++;
+				} while ((position <= length) && (((unsigned char)statement[position] & 0xC0) == 0x80));
+				type = ZIMSqlTokenTypeCharacter;
 			}
 			else { // miscellaneous token
-				NSString *token = [NSString stringWithFormat: @"%c", ch];
-				NSString *type;
 				switch (ch) {
 					case '+':
 					case '*':
 					case '%':
 					case '&':
 					case '~':
-						type = ZIMSqlTokenOperator;
+						type = ZIMSqlTokenTypeOperator;
 						break;
 					case '?':
-						type = ZIMSqlTokenParameter;
+						type = ZIMSqlTokenTypeParameter;
 						break;
 					case ';':
-						type = ZIMSqlTokenTerminal;
+						type = ZIMSqlTokenTypeTerminal;
 						break;
 					default:
-						type = token;
+						type = ZIMSqlTokenTypeCharacter;
 						break;
 				}
-				[_tuples addObject: [NSDictionary dictionaryWithObjectsAndKeys: token, @"token", type, @"type", nil]];
 				position++;
-				//NSLog(@"%c", token);
 			}
+			NSUInteger end = MIN((NSUInteger)position, _size);
+			ZIMSqlTokenizerAppend(&_tokens, &_count, &_capacity, type, (NSUInteger)start, end - (NSUInteger)start);
 		}		
 	}
 	return self;
 }
 
+- (void) dealloc {
+	free(_tokens);
+	free(_buffer);
+}
+
 - (id) objectAtIndex: (NSUInteger)index {
-	return [_tuples objectAtIndex: index];
+	if (index >= _count) {
+		@throw [NSException exceptionWithName: NSRangeException reason: [NSString stringWithFormat: @"Index %lu is beyond bounds.", (unsigned long)index] userInfo: nil];
+	}
+	if (_tuples == nil) {
+		_tuples = [[NSMutableArray alloc] initWithCapacity: _count];
+		for (NSUInteger i = 0; i < _count; i++) {
+			[_tuples addObject: [NSNull null]];
+		}
+	}
+	id tuple = [_tuples objectAtIndex: index];
+	if (tuple == [NSNull null]) {
+		tuple = [NSDictionary dictionaryWithObjectsAndKeys: [self stringAtIndex: index], @"token", [self typeAtIndex: index], @"type", nil];
+		[_tuples replaceObjectAtIndex: index withObject: tuple];
+	}
+	return tuple;
 }
 
 - (NSUInteger) count {
-	return [_tuples count];
+	return _count;
+}
+
+- (ZIMSqlToken) tokenAtIndex: (NSUInteger)index {
+	if (index >= _count) {
+		@throw [NSException exceptionWithName: NSRangeException reason: [NSString stringWithFormat: @"Index %lu is beyond bounds.", (unsigned long)index] userInfo: nil];
+	}
+	return _tokens[index];
+}
+
+- (NSString *) typeAtIndex: (NSUInteger)index {
+	switch ([self tokenAtIndex: index].type) {
+		case ZIMSqlTokenTypeHexadecimal:
+			return ZIMSqlTokenHexadecimal;
+		case ZIMSqlTokenTypeIdentifier:
+			return ZIMSqlTokenIdentifier;
+		case ZIMSqlTokenTypeInteger:
+			return ZIMSqlTokenInteger;
+		case ZIMSqlTokenTypeKeyword:
+			return ZIMSqlTokenKeyword;
+		case ZIMSqlTokenTypeLiteral:
+			return ZIMSqlTokenLiteral;
+		case ZIMSqlTokenTypeOperator:
+			return ZIMSqlTokenOperator;
+		case ZIMSqlTokenTypeParameter:
+			return ZIMSqlTokenParameter;
+		case ZIMSqlTokenTypeReal:
+			return ZIMSqlTokenReal;
+		case ZIMSqlTokenTypeTerminal:
+			return ZIMSqlTokenTerminal;
+		case ZIMSqlTokenTypeWhitespace:
+			return ZIMSqlTokenWhitespace;
+		case ZIMSqlTokenTypeCharacter:
+			return [self stringAtIndex: index];
+		default:
+			return ZIMSqlTokenError;
+	}
+}
+
+- (NSString *) stringAtIndex: (NSUInteger)index {
+	ZIMSqlToken token = [self tokenAtIndex: index];
+	NSString *string = [[NSString alloc] initWithBytes: _buffer + token.offset length: token.length encoding: NSUTF8StringEncoding];
+	if (string == nil) { // i.e. the token ends within a multi-byte character (e.g. an unterminated identifier)
+		string = [[NSString alloc] initWithBytes: _buffer + token.offset length: token.length encoding: NSISOLatin1StringEncoding];
+	}
+	return string;
+}
+
+- (const char *) UTF8String {
+	return _buffer;
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
-	for (NSDictionary *tuple in _tuples) {
-		[sql appendString: [tuple objectForKey: @"token"]];
-	}	
-	return sql;
+	return [NSString stringWithUTF8String: _buffer];
 }
 
 /*
@@ -322,11 +358,10 @@ static NSSet *_keywords = nil;
  */
 - (NSUInteger) countByEnumeratingWithState: (NSFastEnumerationState *)state objects: (id __unsafe_unretained *)buffer count: (NSUInteger)bufferSize {
 	NSUInteger arrayIndex = (NSUInteger)state->state;
-	NSUInteger arraySize = [_tuples count];
 	NSUInteger bufferIndex = 0;
 
-	while ((arrayIndex < arraySize) && (bufferIndex < bufferSize)) {
-		buffer[bufferIndex] = [_tuples objectAtIndex: arrayIndex];
+	while ((arrayIndex < _count) && (bufferIndex < bufferSize)) {
+		buffer[bufferIndex] = [self objectAtIndex: arrayIndex]; // Note: The tuple is retained by _tuples.
 		arrayIndex++;
 		bufferIndex++;
 	}
@@ -339,27 +374,11 @@ static NSSet *_keywords = nil;
 }
 
 + (BOOL) isKeyword: (NSString *)token {
-	if (_keywords == nil) {
-		_keywords = [NSSet setWithObjects: @"ABORT", @"ABS", @"ACTION", @"ADD", @"AFTER", @"ALL", @"ALTER", @"ANALYZE",
-			@"AND",	@"AS", @"ASC", @"ATTACH", @"AUTOINCREMENT", @"AVG", @"BEFORE", @"BEGIN", @"BETWEEN", @"BY", @"CASCADE",
-			@"CASE", @"CAST", @"CHANGES", @"CHECK", @"COALESCE", @"COLLATE", @"COLUMN", @"COMMIT", @"CONFLICT", @"CONSTRAINT",
-			@"COUNT", @"CREATE", @"CROSS", @"CURRENT_DATE", @"CURRENT_TIME", @"CURRENT_TIMESTAMP", @"DATABASE", @"DATE",
-			@"DATETIME", @"DEFAULT", @"DEFERRABLE", @"DEFERRED", @"DELETE", @"DESC", @"DETACH", @"DISTINCT", @"DROP", @"EACH",
-			@"ELSE", @"END", @"ESCAPE", @"EXCEPT", @"EXCLUSIVE", @"EXISTS", @"EXPLAIN", @"FAIL", @"FOR", @"FOREIGN", @"FROM",
-			@"FULL", @"GLOB", @"GROUP", @"GROUP_CONCAT", @"HAVING", @"HEX", @"IF", @"IFNULL", @"IGNORE", @"IMMEDIATE", @"IN",
-			@"INDEX", @"INDEXED", @"INITIALLY", @"INNER", @"INSERT", @"INSTEAD", @"INTERSECT", @"INTO", @"IS", @"ISNULL",
-			@"JOIN", @"JULIANDAY", @"KEY", @"LAST_INSERT_ROWID", @"LEFT", @"LENGTH", @"LIKE", @"LIMIT", @"LOAD_EXTENSION",
-			@"LOWER", @"LTRIM", @"MATCH", @"MAX", @"MIN", @"NATURAL", @"NO", @"NOT", @"NOTNULL", @"NULL", @"NULLIF", @"OF",
-			@"OFFSET", @"ON", @"OR", @"ORDER", @"OUTER", @"PLAN", @"PRAGMA", @"PRIMARY", @"QUERY", @"QUOTE", @"RAISE",
-			@"RANDOM", @"RANDOMBLOB", @"REFERENCES", @"REGEXP", @"REINDEX", @"RELEASE", @"RENAME", @"REPLACE", @"RESTRICT",
-			@"RIGHT", @"ROLLBACK", @"ROUND", @"ROW", @"RTRIM", @"SAVEPOINT", @"SELECT", @"SET", @"SOUNDEX", @"SQLITE_COMPILEOPTION_GET",
-			@"SQLITE_COMPILEOPTION_USED", @"SQLITE_SOURCE_ID", @"SQLITE_VERSION", @"STRFTIME", @"SUBSTR", @"SUM", @"TABLE", @"TEMP",
-			@"TEMPORARY", @"THEN", @"TIME", @"TO", @"TOTAL", @"TOTAL_CHANGES", @"TRANSACTION", @"TRIGGER", @"TRIM", @"TYPEOF",
-			@"UNION", @"UNIQUE", @"UPDATE", @"UPPER", @"USING", @"VACUUM", @"VALUES", @"VIEW", @"VIRTUAL", @"WHEN",
-			@"WHERE", @"ZEROBLOB", nil
-		];
+	const char *bytes = [token UTF8String];
+	if (bytes == NULL) { // i.e. a nil token
+		return NO;
 	}
-	return [_keywords containsObject: [token uppercaseString]];
+	return ZIMSqlTokenizerIsKeyword(bytes, strlen(bytes));
 }
 
 @end
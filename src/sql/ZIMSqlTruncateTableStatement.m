@@ -36,10 +36,13 @@
 }
 
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
-	[sql appendFormat: @"DELETE FROM %@; ", _tableIdentifier];
-	[sql appendFormat: @"DELETE FROM [sqlite_sequence] WHERE [name] = %@;", _tableName];
-	return sql;
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 96];
+	[sql appendCString: "DELETE FROM "];
+	[sql appendString: _tableIdentifier];
+	[sql appendCString: "; DELETE FROM [sqlite_sequence] WHERE [name] = "];
+	[sql appendString: _tableName];
+	[sql appendCString: ";"];
+	return [sql string];
 }
 
 @end
@@ -15,23 +15,32 @@
  */
 
 #import "ZIMSqlStatement.h"
+#import "ZIMSqlCondition.h"
+#import "ZIMSqlParameterizedStatement.h"
 #import "ZIMSqlDataManipulationCommand.h"
 
+@class ZIMSqlSelectStatement;
+
 /*!
  @class					ZIMSqlUpdateStatement
  @discussion			This class represents an SQL update statement.
  @updated				2011-07-15
  @see					http://www.sqlite.org/lang_update.html
  */
-@interface ZIMSqlUpdateStatement : NSObject <ZIMSqlStatement, ZIMSqlDataManipulationCommand> {
+@interface ZIMSqlUpdateStatement : NSObject <NSCopying, ZIMSqlStatement, ZIMSqlParameterizedStatement, ZIMSqlDataManipulationCommand> {
 
 	@protected
 		NSString *_table;
 		NSMutableArray *_column;
-		NSMutableArray *_where;
+		ZIMSqlCondition *_where;
 		NSMutableArray *_orderBy;
 		NSInteger _limit;
 		NSInteger _offset;
+		NSString *_statement;
+		NSString *_parameterizedStatement;
+		NSArray *_parameters;
+		NSMutableArray *_returning;
+		NSMutableDictionary *_temporaryTables;
 
 }
 /*!
@@ -102,6 +111,29 @@
  @updated				2011-05-19
  */
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector; // wrap primitives with NSNumber
+/*!
+ @method				whereKey:after:through:
+ @discussion			This method will restrict the statement to the rows whose key falls within the
+						specified range.  The where clause declared so far is kept intact by grouping it,
+						so that the statement can be run in key-bounded batches.
+ @param key				The column that orders the rows (e.g. "rowid" or the primary key).
+ @param lower			The exclusive lower bound (i.e. nil for no lower bound).
+ @param upper			The inclusive upper bound (i.e. nil for no upper bound).
+ @updated				2026-10-19
+ */
+- (void) whereKey: (NSString *)key after: (id)lower through: (id)upper;
+/*!
+ @method				selectKey:after:limit:
+ @discussion			This method will create a select statement that returns, in ascending order and
+						aliased as "key", the keys of the next rows that this statement would update.  Rows
+						whose key is NULL are never selected.
+ @param key				The column that orders the rows (e.g. "rowid" or the primary key).
+ @param lower			The exclusive lower bound (i.e. nil to start with the first row).
+ @param limit			The maximum number of keys to be returned.
+ @return				The select statement.
+ @updated				2026-10-19
+ */
+- (ZIMSqlSelectStatement *) selectKey: (NSString *)key after: (id)lower limit: (NSInteger)limit;
 /*!
  @method				orderBy:
  @discussion			This method will add an order by clause to the SQL statement.
@@ -154,12 +186,48 @@
  @updated				2011-06-27
  */
 - (void) offset: (NSInteger)offset;
+/*!
+ @method				returning:
+ @discussion			This method will add a column to the "RETURNING" clause of the SQL statement so that
+						the updated rows are returned by the statement itself (see ZIMDbConnection's
+						execute:withParameters:returningAsObject:).  Requires SQLite 3.35.0 or later.
+ @param column			The column to be returned or "*" for every column.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_returning.html
+ */
+- (void) returning: (NSString *)column;
 /*!
  @method				statement
- @discussion			This method will return the SQL statement.
+ @discussion			This method will return the SQL statement.  The statement is only rebuilt
+						after the builder has been modified; otherwise, the cached statement is returned.
  @return				The SQL statement that was constructed.
- @updated				2011-10-19
+ @updated				2026-10-19
  */
 - (NSString *) statement;
+/*!
+ @method				parameterizedStatement
+ @discussion			This method will return the SQL statement with "?" placeholders in place of its
+						values.  Like the statement method, it is only rebuilt after the builder has been
+						modified.
+ @return				The SQL statement that was constructed.
+ @updated				2026-10-19
+ */
+- (NSString *) parameterizedStatement;
+/*!
+ @method				parameters
+ @discussion			This method will return the values to be bound to the placeholders in the
+						parameterized SQL statement, in the order that they appear.
+ @return				The values to be bound.
+ @updated				2026-10-19
+ */
+- (NSArray *) parameters;
+/*!
+ @method				temporaryTables
+ @discussion			This method will return the values of any long "IN" list that must be staged into
+						a temporary table before the parameterized SQL statement is executed.
+ @return				The values to be staged, keyed by their slot in the temporary table.
+ @updated				2026-10-19
+ */
+- (NSDictionary *) temporaryTables;
 
 @end
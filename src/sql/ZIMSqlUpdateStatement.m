@@ -15,6 +15,24 @@
  */
 
 #import "ZIMSqlUpdateStatement.h"
+#import "ZIMSqlSelectStatement.h"
+
+/*!
+ @category		ZIMSqlUpdateStatement (Private)
+ @discussion	This category defines the prototpes for this class's private methods.
+ @updated		2026-10-19
+ */
+@interface ZIMSqlUpdateStatement (Private)
+/*!
+ @method			statementWithParameters:
+ @discussion		This method will build the SQL statement.
+ @param parameters	The array to which the bound values will be appended.  When nil, the values
+					will be rendered as literals.
+ @return			The SQL statement that was constructed.
+ @updated			2026-10-19
+ */
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters;
+@end
 
 @implementation ZIMSqlUpdateStatement
 
@@ -22,20 +40,32 @@
 	if ((self = [super init])) {
 		_table = nil;
 		_column = [[NSMutableArray alloc] init];
-		_where = [[NSMutableArray alloc] init];
+		_where = [ZIMSqlCondition group];
 		_orderBy = [[NSMutableArray alloc] init];
 		_limit = 0;
 		_offset = 0;
+		_statement = nil;
+		_parameterizedStatement = nil;
+		_parameters = nil;
+		_returning = [[NSMutableArray alloc] init];
+		_temporaryTables = nil;
 	}
 	return self;
 }
 
 - (void) table: (NSString *)table {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_table = [ZIMSqlExpression prepareIdentifier: table maxCount: 2];
 }
 
 - (void) column: (NSString *)column value: (id)value {
-	[_column addObject: [NSString stringWithFormat: @"%@ = %@", column, [ZIMSqlExpression prepareValue: value]]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	if (value == nil) {
+		value = [NSNull null];
+	}
+	[_column addObject: [ZIMSqlCondition comparison: [ZIMSqlCondition column: column] operator: ZIMSqlOperatorEqualTo operand: [ZIMSqlCondition operand: value]]];
 }
 
 - (void) whereBlock: (NSString *)brace {
@@ -43,7 +73,9 @@
 }
 
 - (void) whereBlock: (NSString *)brace connector: (NSString *)connector {
-	[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [ZIMSqlExpression prepareEnclosure: brace], nil]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where block: brace connector: connector];
 }
 
 - (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 {
@@ -51,7 +83,9 @@
 }
 
 - (void) where: (NSString *)column1 operator: (NSString *)operator column: (NSString *)column2 connector: (NSString *)connector {
-	[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column1], [operator uppercaseString], [ZIMSqlExpression prepareIdentifier: column2]], nil]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where addCondition: [ZIMSqlCondition predicate: column1 operator: operator column: column2] connector: connector];
 }
 
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value {
@@ -59,27 +93,41 @@
 }
 
 - (void) where: (NSString *)column operator: (NSString *)operator value: (id)value connector: (NSString *)connector {
-	operator = [operator uppercaseString];
-	if ([operator isEqualToString: ZIMSqlOperatorBetween] || [operator isEqualToString: ZIMSqlOperatorNotBetween]) {
-		if (![value isKindOfClass: [NSArray class]]) {
-			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-		}
-		[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@ AND %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 0]], [ZIMSqlExpression prepareValue: [(NSArray *)value objectAtIndex: 1]]], nil]];
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_where addCondition: [ZIMSqlCondition predicate: column operator: operator value: value] connector: connector];
+}
+
+- (void) whereKey: (NSString *)key after: (id)lower through: (id)upper {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	ZIMSqlCondition *where = [ZIMSqlCondition group];
+	if (![_where isEmpty]) {
+		[where addCondition: _where connector: ZIMSqlConnectorAnd];
+	}
+	if (lower != nil) {
+		[where addCondition: [ZIMSqlCondition predicate: key operator: ZIMSqlOperatorGreaterThan value: lower] connector: ZIMSqlConnectorAnd];
+	}
+	if (upper != nil) {
+		[where addCondition: [ZIMSqlCondition predicate: key operator: ZIMSqlOperatorLessThanOrEqualTo value: upper] connector: ZIMSqlConnectorAnd];
+	}
+	_where = where;
+}
+
+- (ZIMSqlSelectStatement *) selectKey: (NSString *)key after: (id)lower limit: (NSInteger)limit {
+	ZIMSqlSelectStatement *select = [[ZIMSqlSelectStatement alloc] init];
+	[select column: key alias: @"key"];
+	[select from: _table];
+	[select where: _where connector: ZIMSqlConnectorAnd];
+	if (lower != nil) {
+		[select where: key operator: ZIMSqlOperatorGreaterThan value: lower];
 	}
 	else {
-		if (([operator isEqualToString: ZIMSqlOperatorIn] || [operator isEqualToString: ZIMSqlOperatorNotIn]) && ![value isKindOfClass: [NSArray class]]) {
-			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Operator requires the value to be declared as an array." userInfo: nil];
-		}
-		else if ([value isKindOfClass: [NSNull class]]) {
-			if ([operator isEqualToString: ZIMSqlOperatorEqualTo]) {
-				operator = ZIMSqlOperatorIs;
-			}
-			else if ([operator isEqualToString: ZIMSqlOperatorNotEqualTo] || [operator isEqualToString: @"!="]) {
-				operator = ZIMSqlOperatorIsNot;
-			}
-		}
-		[_where addObject: [NSArray arrayWithObjects: [ZIMSqlExpression prepareConnector: connector], [NSString stringWithFormat: @"%@ %@ %@", [ZIMSqlExpression prepareIdentifier: column], operator, [ZIMSqlExpression prepareValue: value]], nil]];
+		[select where: key operator: ZIMSqlOperatorIsNot value: [NSNull null]]; // i.e. a NULL key falls outside of every key range
 	}
+	[select orderBy: key];
+	[select limit: limit];
+	return select;
 }
 
 - (void) orderBy: (NSString *)column {
@@ -95,6 +143,8 @@
 }
 
 - (void) orderBy: (NSString *)column descending: (BOOL)descending nulls: (NSString *)weight {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	NSString *field = [ZIMSqlExpression prepareIdentifier: column];
 	NSString *order = [ZIMSqlExpression prepareSortOrder: descending];
 	weight = [ZIMSqlExpression prepareSortWeight: weight];
@@ -110,50 +160,111 @@
 }
 
 - (void) limit: (NSInteger)limit {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_limit = [ZIMSqlExpression prepareNaturalNumber: limit];
 }
 
 - (void) offset: (NSInteger)offset {
+	_statement = nil;
+	_parameterizedStatement = nil;
 	_offset = [ZIMSqlExpression prepareNaturalNumber: offset];
 }
 
+- (void) returning: (NSString *)column {
+	_statement = nil;
+	_parameterizedStatement = nil;
+	[_returning addObject: [ZIMSqlExpression prepareReturning: column]];
+}
+
+- (id) copyWithZone: (NSZone *)zone {
+	ZIMSqlUpdateStatement *copy = [[[self class] allocWithZone: zone] init];
+	copy->_table = _table;
+	[copy->_column addObjectsFromArray: _column];
+	copy->_where = [_where copyWithZone: zone];
+	[copy->_orderBy addObjectsFromArray: _orderBy];
+	copy->_limit = _limit;
+	copy->_offset = _offset;
+	[copy->_returning addObjectsFromArray: _returning];
+	copy->_statement = _statement;
+	copy->_parameterizedStatement = _parameterizedStatement;
+	copy->_parameters = _parameters;
+	copy->_temporaryTables = _temporaryTables;
+	return copy;
+}
+
 - (NSString *) statement {
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	if (_statement == nil) {
+		_statement = [self statementWithParameters: nil];
+	}
+	return _statement;
+}
+
+- (NSString *) parameterizedStatement {
+	if (_parameterizedStatement == nil) {
+		NSMutableArray *parameters = [[NSMutableArray alloc] init];
+		_temporaryTables = [[NSMutableDictionary alloc] init];
+		_parameterizedStatement = [self statementWithParameters: parameters];
+		_parameters = parameters;
+	}
+	return _parameterizedStatement;
+}
+
+- (NSArray *) parameters {
+	[self parameterizedStatement];
+	return _parameters;
+}
+
+- (NSDictionary *) temporaryTables {
+	[self parameterizedStatement];
+	return _temporaryTables;
+}
+
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters {
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 128 + 32 * ([_column count] + [_where count] + [_orderBy count])];
+	NSMutableDictionary *tables = (parameters != nil) ? _temporaryTables : nil;
 
-	[sql appendFormat: @"UPDATE %@ SET ", _table];
+	[sql appendCString: "UPDATE "];
+	[sql appendString: _table];
+	[sql appendCString: " SET "];
 	
-	if ([_column count] > 0) {
-		[sql appendString: [_column componentsJoinedByString: @", "]];
-	}
-
-	if ([_where count] > 0) {
-		BOOL doAppendConnector = NO;
-		[sql appendString: @" WHERE "];
-		for (NSArray *where in _where) {
-			NSString *whereClause = [where objectAtIndex: 1];
-			if (doAppendConnector && ![whereClause isEqualToString: ZIMSqlEnclosureClosingBrace]) {
-				[sql appendFormat: @" %@ ", [where objectAtIndex: 0]];
-			}
-			[sql appendString: whereClause];
-			doAppendConnector = (![whereClause isEqualToString: ZIMSqlEnclosureOpeningBrace]);
+	int i = 0;
+	for (ZIMSqlCondition *column in _column) {
+		if (i > 0) {
+			[sql appendCString: ", "];
 		}
+		[column appendToWriter: sql parameters: parameters temporaryTables: tables];
+		i++;
+	}
+
+	if (![_where isEmpty]) {
+		[sql appendCString: " WHERE "];
+		[_where appendToWriter: sql parameters: parameters temporaryTables: tables];
+	}
+
+	if ([_returning count] > 0) {
+		[sql appendCString: " RETURNING "];
+		[sql appendStrings: _returning separator: ", "];
 	}
 
 	if ([_orderBy count] > 0) {
-		[sql appendFormat: @" ORDER BY %@", [_orderBy componentsJoinedByString: @", "]];
+		[sql appendCString: " ORDER BY "];
+		[sql appendStrings: _orderBy separator: ", "];
 	}
 	
 	if (_limit > 0) {
-		[sql appendFormat: @" LIMIT %d", _limit];
+		[sql appendCString: " LIMIT "];
+		[sql appendInteger: _limit];
 	}
 	
 	if (_offset > 0) {
-		[sql appendFormat: @" OFFSET %d", _offset];
+		[sql appendCString: " OFFSET "];
+		[sql appendInteger: _offset];
 	}
 
-	[sql appendString: @";"];
+	[sql appendBytes: ";" length: 1];
 	
-	return sql;
+	return [sql string];
 }
 
 @end
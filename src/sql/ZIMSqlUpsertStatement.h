@@ -18,8 +18,12 @@
 
 /*!
  @class					ZIMSqlUpsertStatement
- @discussion			This class represents an SQL upsert statement. Execute as a transaction.
- @updated				2011-11-01
+ @discussion			This class represents an SQL upsert statement.  On SQLite 3.24.0 or later, it renders a
+						single "INSERT ... ON CONFLICT ... DO UPDATE" statement, which requires a unique index on
+						the matched columns; otherwise, it renders an "UPDATE OR IGNORE" and an "INSERT OR IGNORE"
+						per row, which should be executed as a transaction.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_UPSERT.html
  @see					http://www.sqlite.org/lang_insert.html
  @see					http://www.sqlite.org/lang_update.html
  @see					http://stackoverflow.com/questions/418898/sqlite-upsert-not-insert-or-replace
@@ -26,11 +26,14 @@
 }
 
 - (void) matching: (NSArray *)columns { // i.e the (composite) primary key
+	_statement = nil;
+	_parameterizedStatement = nil;
 	if (columns != nil) {
 		NSMutableSet *compositeKey = [[NSMutableSet alloc] init];
 		for (NSString *column in columns) {
 			NSString *identifier = [ZIMSqlExpression prepareIdentifier: column maxCount: 1];
-			if ([_column objectForKey: identifier] == nil) {
+			NSDictionary *row = ([_column count] > 0) ? _column : (([_rows count] > 0) ? [_rows objectAtIndex: 0] : nil);
+			if ([row objectForKey: identifier] == nil) {
 				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Must declare column '%@' before it can be matched against.", identifier] userInfo: nil];
 			}
 			[compositeKey addObject: identifier];
@@ -42,40 +45,113 @@
 	}
 }
 
-- (NSString *) statement {
+- (NSString *) statementWithParameters: (NSMutableArray *)parameters {
+	NSMutableArray *rows = [[NSMutableArray alloc] initWithCapacity: [_rows count] + 1];
+	if ([_column count] > 0) {
+		[rows addObject: _column];
+	}
+	[rows addObjectsFromArray: _rows];
+	if ([rows count] == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare at least one column before upserting." userInfo: nil];
+	}
+	if ([_compositeKey count] == 0) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Must declare the columns to be matched against before upserting." userInfo: nil];
+	}
+
+	NSArray *columns = [[[rows objectAtIndex: 0] allKeys] sortedArrayUsingSelector: @selector(compare:)]; // i.e. so that the same columns always render the same SQL statement
+	NSArray *compositeKey = [[_compositeKey allObjects] sortedArrayUsingSelector: @selector(compare:)];
+	ZIMSqlWriter *sql = [[ZIMSqlWriter alloc] initWithCapacity: 128 + 64 * [columns count] * [rows count]];
+	NSMutableDictionary *tables = (parameters != nil) ? _temporaryTables : nil;
+
+	if (ZIMSqlLibraryVersion() >= 3024000) { // i.e. the upsert clause was added in SQLite 3.24.0
+		// Note: A native upsert probes the unique index once and is a single statement, so it can be prepared
+		// once and bound per chunk of rows.  The columns that are matched against must have a unique index.
+		[sql appendCString: "INSERT INTO "];
+		[sql appendString: _table];
+		[sql appendCString: " ("];
+		[sql appendStrings: columns separator: ", "];
+		[sql appendCString: ") VALUES "];
+		[ZIMSqlInsertStatement appendRows: rows columns: columns toWriter: sql parameters: parameters temporaryTables: tables];
+		[sql appendCString: " ON CONFLICT ("];
+		[sql appendStrings: compositeKey separator: ", "];
+		[sql appendCString: ") DO "];
+		int i = 0;
+		for (NSString *column in columns) {
+			if (![_compositeKey containsObject: column]) {
+				[sql appendCString: (i > 0) ? ", " : "UPDATE SET "];
+				[sql appendString: column];
+				[sql appendCString: " = excluded."];
+				[sql appendString: column];
+				i++;
+			}
+		}
+		if (i == 0) {
+			[sql appendCString: "NOTHING"];
+		}
+		if ([_returning count] > 0) {
+			[sql appendCString: " RETURNING "];
+			[sql appendStrings: _returning separator: ", "];
+		}
+		[sql appendBytes: ";" length: 1];
+		return [sql string];
+	}
+
 	// Note: Because "INSERT OR REPLACE" requires prior knowledge of the table's columns to properly update a record,
 	// this method to mimicing an upsert statement was chosen.  Therefore, always match against either the primary key
 	// or a unique key.
 
-	NSMutableString *sql = [[NSMutableString alloc] init];
+	int r = 0;
+	for (NSDictionary *row in rows) {
+		if (r > 0) {
+			[sql appendBytes: " " length: 1];
+		}
 
-	[sql appendFormat: @"UPDATE OR IGNORE %@ SET ", _table];
-	
-	NSMutableArray *set = [[NSMutableArray alloc] init];
-	NSMutableArray *where = [[NSMutableArray alloc] init];
+		if ([columns count] > [_compositeKey count]) {
+			[sql appendCString: "UPDATE OR IGNORE "];
+			[sql appendString: _table];
+			[sql appendCString: " SET "];
 
-	for (NSString *column in _column) {
-		if ([_compositeKey containsObject: column]) {
-			[where addObject: [NSString stringWithFormat: @"%@ = %@", column, [_column objectForKey: column]]];
-		}
-		else {
-			[set addObject: [NSString stringWithFormat: @"%@ = %@", column, [_column objectForKey: column]]];
-		}
-	}
+			int i = 0;
+			for (NSString *column in columns) {
+				if (![_compositeKey containsObject: column]) {
+					if (i > 0) {
+						[sql appendCString: ", "];
+					}
+					[sql appendString: column];
+					[sql appendCString: " = "];
+					[ZIMSqlExpression appendValue: [row objectForKey: column] toWriter: sql parameters: parameters temporaryTables: tables];
+					i++;
+				}
+			}
 
-	[sql appendString: [set componentsJoinedByString: @", "]];
-	[sql appendString: @" WHERE "];
-	[sql appendString: [where componentsJoinedByString: @" AND "]];
+			[sql appendCString: " WHERE "];
 
-	[sql appendString: @"; "];
+			i = 0;
+			for (NSString *column in compositeKey) {
+				if (i > 0) {
+					[sql appendCString: " AND "];
+				}
+				[sql appendString: column];
+				[sql appendCString: " = "];
+				[ZIMSqlExpression appendValue: [row objectForKey: column] toWriter: sql parameters: parameters temporaryTables: tables];
+				i++;
+			}
 
-	[sql appendFormat: @"INSERT OR IGNORE INTO %@ ", _table];
+			[sql appendCString: "; "];
+		}
 
-	[sql appendFormat: @"(%@) VALUES (%@)", [[_column allKeys] componentsJoinedByString: @", "], [[_column allValues] componentsJoinedByString: @", "]];
+		[sql appendCString: "INSERT OR IGNORE INTO "];
+		[sql appendString: _table];
+		[sql appendCString: " ("];
+		[sql appendStrings: columns separator: ", "];
+		[sql appendCString: ") VALUES "];
+		[ZIMSqlInsertStatement appendRows: [NSArray arrayWithObject: row] columns: columns toWriter: sql parameters: parameters temporaryTables: tables];
 
-	[sql appendString: @";"];
+		[sql appendBytes: ";" length: 1];
+		r++;
+	}
 
-	return sql;
+	return [sql string];
 }
 
 @end
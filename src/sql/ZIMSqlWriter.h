@@ -0,0 +1,138 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+/*!
+ @class					ZIMSqlWriter
+ @discussion			This class is a growable UTF-8 buffer into which SQL statements are rendered.  The
+						buffer is reserved up front using an estimate of the statement's length so that most
+						statements are rendered without reallocating, and is converted into a string only once.
+ @updated				2026-10-19
+ */
+@interface ZIMSqlWriter : NSObject {
+
+	@protected
+		char *_buffer;
+		NSUInteger _length;
+		NSUInteger _capacity;
+
+}
+/*!
+ @method				initWithCapacity:
+ @discussion			This constructor creates an instance of this class with the specified capacity.
+ @param capacity		The estimated number of bytes to be written.
+ @return				An instance of this class.
+ @updated				2026-10-19
+ */
+- (id) initWithCapacity: (NSUInteger)capacity;
+/*!
+ @method				reserve:
+ @discussion			This method will ensure that the specified number of bytes can be appended without
+						reallocating the buffer.
+ @param length			The number of bytes to be reserved.
+ @updated				2026-10-19
+ */
+- (void) reserve: (NSUInteger)length;
+/*!
+ @method				appendBytes:length:
+ @discussion			This method will append the specified UTF-8 bytes.
+ @param bytes			The bytes to be appended.
+ @param length			The number of bytes to be appended.
+ @updated				2026-10-19
+ */
+- (void) appendBytes: (const char *)bytes length: (NSUInteger)length;
+/*!
+ @method				appendCString:
+ @discussion			This method will append the specified NUL-terminated UTF-8 string.
+ @param string			The string to be appended.
+ @updated				2026-10-19
+ */
+- (void) appendCString: (const char *)string;
+/*!
+ @method				appendString:
+ @discussion			This method will append the specified string.  A nil string is appended as "(null)".
+ @param string			The string to be appended.
+ @updated				2026-10-19
+ */
+- (void) appendString: (NSString *)string;
+/*!
+ @method				appendStrings:separator:
+ @discussion			This method will append the specified strings, separated by the specified separator.
+ @param strings			The strings to be appended.
+ @param separator		The NUL-terminated UTF-8 separator.
+ @updated				2026-10-19
+ */
+- (void) appendStrings: (NSArray *)strings separator: (const char *)separator;
+/*!
+ @method				appendInteger:
+ @discussion			This method will append the specified integer.
+ @param integer			The integer to be appended.
+ @updated				2026-10-19
+ */
+- (void) appendInteger: (long long)integer;
+/*!
+ @method				appendNumber:
+ @discussion			This method will append the specified number as a literal.  Integers are formatted
+						directly, while doubles are formatted with the fewest digits that still round-trip
+						(and always as a real).  NaN and infinity have no literal and raise an exception.
+ @param number			The number to be appended.
+ @updated				2026-10-19
+ */
+- (void) appendNumber: (NSNumber *)number;
+/*!
+ @method				appendQuotedString:
+ @discussion			This method will escape the specified string as a literal in a single pass over its
+						UTF-8 bytes.  Like sqlite3_mprintf's "%q", the string ends at the first NUL character,
+						and a nil string is rendered as NULL.
+ @param string			The string to be appended.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/c3ref/mprintf.html
+ */
+- (void) appendQuotedString: (NSString *)string;
+/*!
+ @method				appendBlob:
+ @discussion			This method will encode the specified data as a blob literal (i.e. X'...') using a
+						lookup table.
+ @param data			The data to be appended.
+ @updated				2026-10-19
+ @see					http://www.sqlite.org/lang_expr.html#literal_values_constants_
+ */
+- (void) appendBlob: (NSData *)data;
+/*!
+ @method				length
+ @discussion			This method will return the number of bytes written.
+ @return				The number of bytes written.
+ @updated				2026-10-19
+ */
+- (NSUInteger) length;
+/*!
+ @method				UTF8String
+ @discussion			This method will return the bytes written as a NUL-terminated UTF-8 string, which
+						remains valid until the writer is next modified or deallocated.
+ @return				The bytes written.
+ @updated				2026-10-19
+ */
+- (const char *) UTF8String;
+/*!
+ @method				string
+ @discussion			This method will convert the bytes written into a string.
+ @return				The string that was written.
+ @updated				2026-10-19
+ */
+- (NSString *) string;
+
+@end
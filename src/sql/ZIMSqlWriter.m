@@ -0,0 +1,227 @@
+/*
+ * Copyright 2011 Ziminji
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <math.h>
+#import "ZIMSqlWriter.h"
+
+@implementation ZIMSqlWriter
+
+- (id) init {
+	return [self initWithCapacity: 256];
+}
+
+- (id) initWithCapacity: (NSUInteger)capacity {
+	if ((self = [super init])) {
+		_length = 0;
+		_capacity = MAX(capacity, (NSUInteger)16) + 1; // i.e. plus the NUL terminator
+		_buffer = (char *)malloc(_capacity);
+		if (_buffer == NULL) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Unable to allocate memory for SQL statement." userInfo: nil];
+		}
+	}
+	return self;
+}
+
+- (void) reserve: (NSUInteger)length {
+	NSUInteger required = _length + length + 1;
+	if (required > _capacity) {
+		NSUInteger capacity = _capacity * 2;
+		while (capacity < required) {
+			capacity *= 2;
+		}
+		char *buffer = (char *)realloc(_buffer, capacity);
+		if (buffer == NULL) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Unable to allocate memory for SQL statement." userInfo: nil];
+		}
+		_buffer = buffer;
+		_capacity = capacity;
+	}
+}
+
+- (void) appendBytes: (const char *)bytes length: (NSUInteger)length {
+	[self reserve: length];
+	memcpy(_buffer + _length, bytes, length);
+	_length += length;
+}
+
+- (void) appendCString: (const char *)string {
+	if (string == NULL) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Unable to append a NULL string." userInfo: nil];
+	}
+	[self appendBytes: string length: strlen(string)];
+}
+
+- (void) appendString: (NSString *)string {
+	if (string == nil) {
+		[self appendBytes: "(null)" length: 6]; // i.e. as a format string would render it
+		return;
+	}
+	const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+	if (bytes != NULL) {
+		[self appendBytes: bytes length: strlen(bytes)];
+	}
+	else {
+		NSUInteger length = [string maximumLengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+		NSUInteger used = 0;
+		NSRange remaining = NSMakeRange(0, 0);
+		[self reserve: length];
+		[string getBytes: _buffer + _length maxLength: length usedLength: &used encoding: NSUTF8StringEncoding options: 0 range: NSMakeRange(0, [string length]) remainingRange: &remaining];
+		if (remaining.length > 0) {
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Unable to encode string as UTF-8. '%@'", string] userInfo: nil];
+		}
+		_length += used;
+	}
+}
+
+- (void) appendStrings: (NSArray *)strings separator: (const char *)separator {
+	size_t length = strlen(separator);
+	int i = 0;
+	for (NSString *string in strings) {
+		if (i > 0) {
+			[self appendBytes: separator length: length];
+		}
+		[self appendString: string];
+		i++;
+	}
+}
+
+- (void) appendInteger: (long long)integer {
+	char buffer[24];
+	BOOL isNegative = (integer < 0);
+	unsigned long long magnitude = isNegative ? (0ULL - (unsigned long long)integer) : (unsigned long long)integer;
+	char *digit = buffer + sizeof(buffer);
+	do {
+		*--digit = (char)('0' + (magnitude % 10));
+		magnitude /= 10;
+	} while (magnitude > 0);
+	if (isNegative) {
+		*--digit = '-';
+	}
+	[self appendBytes: digit length: (buffer + sizeof(buffer)) - digit];
+}
+
+- (void) appendNumber: (NSNumber *)number {
+	if ([number isKindOfClass: [NSDecimalNumber class]]) {
+		[self appendString: [number stringValue]];
+		return;
+	}
+	const char *type = [number objCType];
+	switch (type[0]) {
+		case 'c': case 'C': case 's': case 'S': case 'i': case 'I': case 'l': case 'L': case 'q': case 'B': {
+			[self appendInteger: [number longLongValue]];
+			break;
+		}
+		case 'Q': {
+			char buffer[24];
+			unsigned long long magnitude = [number unsignedLongLongValue];
+			char *digit = buffer + sizeof(buffer);
+			do {
+				*--digit = (char)('0' + (magnitude % 10));
+				magnitude /= 10;
+			} while (magnitude > 0);
+			[self appendBytes: digit length: (buffer + sizeof(buffer)) - digit];
+			break;
+		}
+		case 'f': case 'd': {
+			double real = [number doubleValue];
+			if (!isfinite(real)) {
+				@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Unable to render a non-finite number as a literal. '%@'", number] userInfo: nil];
+			}
+			else {
+				char buffer[32];
+				for (int precision = 15; precision <= 17; precision++) {
+					snprintf(buffer, sizeof(buffer), "%.*g", precision, real);
+					if (strtod(buffer, NULL) == real) {
+						break;
+					}
+				}
+				[self appendCString: buffer];
+				if (strpbrk(buffer, ".e") == NULL) {
+					[self appendBytes: ".0" length: 2];
+				}
+			}
+			break;
+		}
+		default:
+			[self appendString: [number stringValue]];
+			break;
+	}
+}
+
+- (void) appendQuotedString: (NSString *)string {
+	if (string == nil) {
+		[self appendBytes: "NULL" length: 4];
+		return;
+	}
+	const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+	if (bytes == NULL) {
+		bytes = [string UTF8String];
+		if (bytes == NULL) { // e.g. the string contains a lone surrogate
+			@throw [NSException exceptionWithName: @"ZIMSqlException" reason: [NSString stringWithFormat: @"Unable to encode string as UTF-8. '%@'", string] userInfo: nil];
+		}
+	}
+	[self appendBytes: "'" length: 1];
+	const char *run = bytes;
+	const char *byte = bytes;
+	for (; *byte != '\0'; byte++) {
+		if (*byte == '\'') {
+			[self appendBytes: run length: (byte - run) + 1];
+			[self appendBytes: "'" length: 1];
+			run = byte + 1;
+		}
+	}
+	[self appendBytes: run length: byte - run];
+	[self appendBytes: "'" length: 1];
+}
+
+- (void) appendBlob: (NSData *)data {
+	static const char digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+	NSUInteger length = [data length];
+	[self reserve: (length * 2) + 3];
+	char *hex = _buffer + _length;
+	*hex++ = 'X';
+	*hex++ = '\'';
+	const uint8_t *bytes = (const uint8_t *)[data bytes];
+	for (NSUInteger i = 0; i < length; i++) {
+		hex[i * 2] = digits[bytes[i] >> 4];
+		hex[i * 2 + 1] = digits[bytes[i] & 0x0F];
+	}
+	hex[length * 2] = '\'';
+	_length += (length * 2) + 3;
+}
+
+- (NSUInteger) length {
+	return _length;
+}
+
+- (const char *) UTF8String {
+	_buffer[_length] = '\0';
+	return _buffer;
+}
+
+- (NSString *) string {
+	NSString *string = [[NSString alloc] initWithBytes: _buffer length: _length encoding: NSUTF8StringEncoding];
+	if (string == nil) {
+		@throw [NSException exceptionWithName: @"ZIMSqlException" reason: @"Unable to decode SQL statement as UTF-8." userInfo: nil];
+	}
+	return string;
+}
+
+- (void) dealloc {
+	free(_buffer);
+}
+
+@end